@@ -0,0 +1,257 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/FindGMP.cmake"
+  "/root/repo/cmake/LibFindMacros.cmake"
+  "/root/repo/cmake/SymEngineConfig.cmake.in"
+  "/root/repo/cmake/SymEngineConfigVersion.cmake.in"
+  "/root/repo/cmake/UserOverride.cmake"
+  "/root/repo/cmake/checkstdtostring.cpp"
+  "/root/repo/symengine/CMakeLists.txt"
+  "/root/repo/symengine/symengine_config.h.in"
+  "/root/repo/symengine/symengine_config_cling.h.in"
+  "/root/repo/symengine/tests/CMakeLists.txt"
+  "/root/repo/symengine/tests/basic/CMakeLists.txt"
+  "/root/repo/symengine/tests/cwrapper/CMakeLists.txt"
+  "/root/repo/symengine/tests/eval/CMakeLists.txt"
+  "/root/repo/symengine/tests/expression/CMakeLists.txt"
+  "/root/repo/symengine/tests/finitediff/CMakeLists.txt"
+  "/root/repo/symengine/tests/logic/CMakeLists.txt"
+  "/root/repo/symengine/tests/matrix/CMakeLists.txt"
+  "/root/repo/symengine/tests/ntheory/CMakeLists.txt"
+  "/root/repo/symengine/tests/polynomial/CMakeLists.txt"
+  "/root/repo/symengine/tests/printing/CMakeLists.txt"
+  "/root/repo/symengine/tests/rcp/CMakeLists.txt"
+  "/root/repo/symengine/utilities/catch/CMakeLists.txt"
+  "/root/repo/symengine/utilities/matchpycpp/CMakeLists.txt"
+  "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt"
+  "/root/repo/symengine/utilities/matchpycpp/tests/CMakeLists.txt"
+  "/root/repo/symengine/utilities/matchpycpp/tests/bipartite/CMakeLists.txt"
+  "/root/repo/symengine/utilities/matchpycpp/tests/hopcroft_karp/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckLinkerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "SymEngineConfig.cmake"
+  "CMakeFiles/SymEngineConfig.cmake"
+  "SymEngineConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/symengine_config.h"
+  "symengine/symengine_config_cling.h"
+  "symengine/symengine_export.h"
+  "symengine/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/utilities/matchpycpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/utilities/catch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/rcp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/basic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/ntheory/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/matrix/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/printing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/polynomial/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/eval/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/cwrapper/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/expression/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/logic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/tests/finitediff/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/utilities/matchpycpp/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/utilities/matchpycpp/tests/bipartite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/utilities/matchpycpp/tests/hopcroft_karp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "symengine/CMakeFiles/symengine.dir/DependInfo.cmake"
+  "symengine/utilities/catch/CMakeFiles/catch.dir/DependInfo.cmake"
+  "symengine/tests/rcp/CMakeFiles/test_rcp.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_basic.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_arit.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_poly.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_series.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_series_generic.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_functions.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_subs.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_integer.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_rational.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_relationals.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_number.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_as_numer_denom.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_parser.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_serialize-cereal.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_sbml_parser.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_sets.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_fields.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_infinity.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_nan.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_solve.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_as_real_imag.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_cse.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_count_ops.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_test_visitors.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_assumptions.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_refine.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_simplify.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_tuple.dir/DependInfo.cmake"
+  "symengine/tests/basic/CMakeFiles/test_tribool.dir/DependInfo.cmake"
+  "symengine/tests/ntheory/CMakeFiles/test_ntheory.dir/DependInfo.cmake"
+  "symengine/tests/ntheory/CMakeFiles/test_diophantine.dir/DependInfo.cmake"
+  "symengine/tests/ntheory/CMakeFiles/test_ntheory_funcs.dir/DependInfo.cmake"
+  "symengine/tests/matrix/CMakeFiles/test_matrix.dir/DependInfo.cmake"
+  "symengine/tests/matrix/CMakeFiles/test_matrixexpr.dir/DependInfo.cmake"
+  "symengine/tests/printing/CMakeFiles/test_printing.dir/DependInfo.cmake"
+  "symengine/tests/printing/CMakeFiles/test_ccode.dir/DependInfo.cmake"
+  "symengine/tests/polynomial/CMakeFiles/test_uintpoly.dir/DependInfo.cmake"
+  "symengine/tests/polynomial/CMakeFiles/test_uratpoly.dir/DependInfo.cmake"
+  "symengine/tests/polynomial/CMakeFiles/test_mintpoly.dir/DependInfo.cmake"
+  "symengine/tests/polynomial/CMakeFiles/test_uexprpoly.dir/DependInfo.cmake"
+  "symengine/tests/polynomial/CMakeFiles/test_mexprpoly.dir/DependInfo.cmake"
+  "symengine/tests/polynomial/CMakeFiles/test_basic_conversions.dir/DependInfo.cmake"
+  "symengine/tests/eval/CMakeFiles/test_evalf.dir/DependInfo.cmake"
+  "symengine/tests/eval/CMakeFiles/test_eval_double.dir/DependInfo.cmake"
+  "symengine/tests/eval/CMakeFiles/test_lambda_double.dir/DependInfo.cmake"
+  "symengine/tests/cwrapper/CMakeFiles/test_cwrapper.dir/DependInfo.cmake"
+  "symengine/tests/expression/CMakeFiles/test_expression.dir/DependInfo.cmake"
+  "symengine/tests/logic/CMakeFiles/test_logic.dir/DependInfo.cmake"
+  "symengine/tests/finitediff/CMakeFiles/test_finitediff.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/tests/bipartite/CMakeFiles/test_bipartite.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/tests/hopcroft_karp/CMakeFiles/test_hopcroft_karp.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/test_case001.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/test_case002.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/test_case003.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/test_case004.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/test_case005.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/test_case006.dir/DependInfo.cmake"
+  "symengine/utilities/matchpycpp/autogen_tests/CMakeFiles/test_case007.dir/DependInfo.cmake"
+  )
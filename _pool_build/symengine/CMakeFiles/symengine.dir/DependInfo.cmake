@@ -0,0 +1,109 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/symengine/add.cpp" "symengine/CMakeFiles/symengine.dir/add.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/add.cpp.o.d"
+  "/root/repo/symengine/assumptions.cpp" "symengine/CMakeFiles/symengine.dir/assumptions.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/assumptions.cpp.o.d"
+  "/root/repo/symengine/basic.cpp" "symengine/CMakeFiles/symengine.dir/basic.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/basic.cpp.o.d"
+  "/root/repo/symengine/complex.cpp" "symengine/CMakeFiles/symengine.dir/complex.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/complex.cpp.o.d"
+  "/root/repo/symengine/complex_double.cpp" "symengine/CMakeFiles/symengine.dir/complex_double.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/complex_double.cpp.o.d"
+  "/root/repo/symengine/constants.cpp" "symengine/CMakeFiles/symengine.dir/constants.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/constants.cpp.o.d"
+  "/root/repo/symengine/cse.cpp" "symengine/CMakeFiles/symengine.dir/cse.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/cse.cpp.o.d"
+  "/root/repo/symengine/cwrapper.cpp" "symengine/CMakeFiles/symengine.dir/cwrapper.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/cwrapper.cpp.o.d"
+  "/root/repo/symengine/dense_matrix.cpp" "symengine/CMakeFiles/symengine.dir/dense_matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/dense_matrix.cpp.o.d"
+  "/root/repo/symengine/derivative.cpp" "symengine/CMakeFiles/symengine.dir/derivative.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/derivative.cpp.o.d"
+  "/root/repo/symengine/dict.cpp" "symengine/CMakeFiles/symengine.dir/dict.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/dict.cpp.o.d"
+  "/root/repo/symengine/diophantine.cpp" "symengine/CMakeFiles/symengine.dir/diophantine.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/diophantine.cpp.o.d"
+  "/root/repo/symengine/eval.cpp" "symengine/CMakeFiles/symengine.dir/eval.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/eval.cpp.o.d"
+  "/root/repo/symengine/eval_double.cpp" "symengine/CMakeFiles/symengine.dir/eval_double.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/eval_double.cpp.o.d"
+  "/root/repo/symengine/expand.cpp" "symengine/CMakeFiles/symengine.dir/expand.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/expand.cpp.o.d"
+  "/root/repo/symengine/expression.cpp" "symengine/CMakeFiles/symengine.dir/expression.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/expression.cpp.o.d"
+  "/root/repo/symengine/fields.cpp" "symengine/CMakeFiles/symengine.dir/fields.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/fields.cpp.o.d"
+  "/root/repo/symengine/finitediff.cpp" "symengine/CMakeFiles/symengine.dir/finitediff.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/finitediff.cpp.o.d"
+  "/root/repo/symengine/functions.cpp" "symengine/CMakeFiles/symengine.dir/functions.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/functions.cpp.o.d"
+  "/root/repo/symengine/infinity.cpp" "symengine/CMakeFiles/symengine.dir/infinity.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/infinity.cpp.o.d"
+  "/root/repo/symengine/integer.cpp" "symengine/CMakeFiles/symengine.dir/integer.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/integer.cpp.o.d"
+  "/root/repo/symengine/intern.cpp" "symengine/CMakeFiles/symengine.dir/intern.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/intern.cpp.o.d"
+  "/root/repo/symengine/logic.cpp" "symengine/CMakeFiles/symengine.dir/logic.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/logic.cpp.o.d"
+  "/root/repo/symengine/matrices/conjugate_matrix.cpp" "symengine/CMakeFiles/symengine.dir/matrices/conjugate_matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/conjugate_matrix.cpp.o.d"
+  "/root/repo/symengine/matrices/diagonal_matrix.cpp" "symengine/CMakeFiles/symengine.dir/matrices/diagonal_matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/diagonal_matrix.cpp.o.d"
+  "/root/repo/symengine/matrices/hadamard_product.cpp" "symengine/CMakeFiles/symengine.dir/matrices/hadamard_product.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/hadamard_product.cpp.o.d"
+  "/root/repo/symengine/matrices/identity_matrix.cpp" "symengine/CMakeFiles/symengine.dir/matrices/identity_matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/identity_matrix.cpp.o.d"
+  "/root/repo/symengine/matrices/immutable_dense_matrix.cpp" "symengine/CMakeFiles/symengine.dir/matrices/immutable_dense_matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/immutable_dense_matrix.cpp.o.d"
+  "/root/repo/symengine/matrices/is_diagonal.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_diagonal.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_diagonal.cpp.o.d"
+  "/root/repo/symengine/matrices/is_lower.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_lower.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_lower.cpp.o.d"
+  "/root/repo/symengine/matrices/is_real.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_real.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_real.cpp.o.d"
+  "/root/repo/symengine/matrices/is_square.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_square.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_square.cpp.o.d"
+  "/root/repo/symengine/matrices/is_symmetric.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_symmetric.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_symmetric.cpp.o.d"
+  "/root/repo/symengine/matrices/is_toeplitz.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_toeplitz.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_toeplitz.cpp.o.d"
+  "/root/repo/symengine/matrices/is_upper.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_upper.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_upper.cpp.o.d"
+  "/root/repo/symengine/matrices/is_zero.cpp" "symengine/CMakeFiles/symengine.dir/matrices/is_zero.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/is_zero.cpp.o.d"
+  "/root/repo/symengine/matrices/matrix_add.cpp" "symengine/CMakeFiles/symengine.dir/matrices/matrix_add.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/matrix_add.cpp.o.d"
+  "/root/repo/symengine/matrices/matrix_mul.cpp" "symengine/CMakeFiles/symengine.dir/matrices/matrix_mul.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/matrix_mul.cpp.o.d"
+  "/root/repo/symengine/matrices/matrix_symbol.cpp" "symengine/CMakeFiles/symengine.dir/matrices/matrix_symbol.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/matrix_symbol.cpp.o.d"
+  "/root/repo/symengine/matrices/size.cpp" "symengine/CMakeFiles/symengine.dir/matrices/size.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/size.cpp.o.d"
+  "/root/repo/symengine/matrices/trace.cpp" "symengine/CMakeFiles/symengine.dir/matrices/trace.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/trace.cpp.o.d"
+  "/root/repo/symengine/matrices/transpose.cpp" "symengine/CMakeFiles/symengine.dir/matrices/transpose.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/transpose.cpp.o.d"
+  "/root/repo/symengine/matrices/zero_matrix.cpp" "symengine/CMakeFiles/symengine.dir/matrices/zero_matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrices/zero_matrix.cpp.o.d"
+  "/root/repo/symengine/matrix.cpp" "symengine/CMakeFiles/symengine.dir/matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/matrix.cpp.o.d"
+  "/root/repo/symengine/monomials.cpp" "symengine/CMakeFiles/symengine.dir/monomials.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/monomials.cpp.o.d"
+  "/root/repo/symengine/mp_wrapper.cpp" "symengine/CMakeFiles/symengine.dir/mp_wrapper.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/mp_wrapper.cpp.o.d"
+  "/root/repo/symengine/mul.cpp" "symengine/CMakeFiles/symengine.dir/mul.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/mul.cpp.o.d"
+  "/root/repo/symengine/nan.cpp" "symengine/CMakeFiles/symengine.dir/nan.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/nan.cpp.o.d"
+  "/root/repo/symengine/ntheory.cpp" "symengine/CMakeFiles/symengine.dir/ntheory.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/ntheory.cpp.o.d"
+  "/root/repo/symengine/ntheory_funcs.cpp" "symengine/CMakeFiles/symengine.dir/ntheory_funcs.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/ntheory_funcs.cpp.o.d"
+  "/root/repo/symengine/number.cpp" "symengine/CMakeFiles/symengine.dir/number.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/number.cpp.o.d"
+  "/root/repo/symengine/numer_denom.cpp" "symengine/CMakeFiles/symengine.dir/numer_denom.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/numer_denom.cpp.o.d"
+  "/root/repo/symengine/parser/parser.cpp" "symengine/CMakeFiles/symengine.dir/parser/parser.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/parser/parser.cpp.o.d"
+  "/root/repo/symengine/parser/parser.tab.cc" "symengine/CMakeFiles/symengine.dir/parser/parser.tab.cc.o" "gcc" "symengine/CMakeFiles/symengine.dir/parser/parser.tab.cc.o.d"
+  "/root/repo/symengine/parser/parser_old.cpp" "symengine/CMakeFiles/symengine.dir/parser/parser_old.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/parser/parser_old.cpp.o.d"
+  "/root/repo/symengine/parser/sbml/sbml_parser.cpp" "symengine/CMakeFiles/symengine.dir/parser/sbml/sbml_parser.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/parser/sbml/sbml_parser.cpp.o.d"
+  "/root/repo/symengine/parser/sbml/sbml_parser.tab.cc" "symengine/CMakeFiles/symengine.dir/parser/sbml/sbml_parser.tab.cc.o" "gcc" "symengine/CMakeFiles/symengine.dir/parser/sbml/sbml_parser.tab.cc.o.d"
+  "/root/repo/symengine/parser/sbml/sbml_tokenizer.cpp" "symengine/CMakeFiles/symengine.dir/parser/sbml/sbml_tokenizer.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/parser/sbml/sbml_tokenizer.cpp.o.d"
+  "/root/repo/symengine/parser/tokenizer.cpp" "symengine/CMakeFiles/symengine.dir/parser/tokenizer.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/parser/tokenizer.cpp.o.d"
+  "/root/repo/symengine/polys/basic_conversions.cpp" "symengine/CMakeFiles/symengine.dir/polys/basic_conversions.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/polys/basic_conversions.cpp.o.d"
+  "/root/repo/symengine/polys/msymenginepoly.cpp" "symengine/CMakeFiles/symengine.dir/polys/msymenginepoly.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/polys/msymenginepoly.cpp.o.d"
+  "/root/repo/symengine/polys/uexprpoly.cpp" "symengine/CMakeFiles/symengine.dir/polys/uexprpoly.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/polys/uexprpoly.cpp.o.d"
+  "/root/repo/symengine/polys/uintpoly.cpp" "symengine/CMakeFiles/symengine.dir/polys/uintpoly.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/polys/uintpoly.cpp.o.d"
+  "/root/repo/symengine/polys/uratpoly.cpp" "symengine/CMakeFiles/symengine.dir/polys/uratpoly.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/polys/uratpoly.cpp.o.d"
+  "/root/repo/symengine/pool_allocator.cpp" "symengine/CMakeFiles/symengine.dir/pool_allocator.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/pool_allocator.cpp.o.d"
+  "/root/repo/symengine/pow.cpp" "symengine/CMakeFiles/symengine.dir/pow.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/pow.cpp.o.d"
+  "/root/repo/symengine/prime_sieve.cpp" "symengine/CMakeFiles/symengine.dir/prime_sieve.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/prime_sieve.cpp.o.d"
+  "/root/repo/symengine/printers/codegen.cpp" "symengine/CMakeFiles/symengine.dir/printers/codegen.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/printers/codegen.cpp.o.d"
+  "/root/repo/symengine/printers/latex.cpp" "symengine/CMakeFiles/symengine.dir/printers/latex.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/printers/latex.cpp.o.d"
+  "/root/repo/symengine/printers/mathml.cpp" "symengine/CMakeFiles/symengine.dir/printers/mathml.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/printers/mathml.cpp.o.d"
+  "/root/repo/symengine/printers/sbml.cpp" "symengine/CMakeFiles/symengine.dir/printers/sbml.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/printers/sbml.cpp.o.d"
+  "/root/repo/symengine/printers/stringbox.cpp" "symengine/CMakeFiles/symengine.dir/printers/stringbox.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/printers/stringbox.cpp.o.d"
+  "/root/repo/symengine/printers/strprinter.cpp" "symengine/CMakeFiles/symengine.dir/printers/strprinter.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/printers/strprinter.cpp.o.d"
+  "/root/repo/symengine/printers/unicode.cpp" "symengine/CMakeFiles/symengine.dir/printers/unicode.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/printers/unicode.cpp.o.d"
+  "/root/repo/symengine/rational.cpp" "symengine/CMakeFiles/symengine.dir/rational.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/rational.cpp.o.d"
+  "/root/repo/symengine/real_double.cpp" "symengine/CMakeFiles/symengine.dir/real_double.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/real_double.cpp.o.d"
+  "/root/repo/symengine/refine.cpp" "symengine/CMakeFiles/symengine.dir/refine.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/refine.cpp.o.d"
+  "/root/repo/symengine/rewrite.cpp" "symengine/CMakeFiles/symengine.dir/rewrite.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/rewrite.cpp.o.d"
+  "/root/repo/symengine/rings.cpp" "symengine/CMakeFiles/symengine.dir/rings.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/rings.cpp.o.d"
+  "/root/repo/symengine/series.cpp" "symengine/CMakeFiles/symengine.dir/series.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/series.cpp.o.d"
+  "/root/repo/symengine/series_generic.cpp" "symengine/CMakeFiles/symengine.dir/series_generic.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/series_generic.cpp.o.d"
+  "/root/repo/symengine/set_funcs.cpp" "symengine/CMakeFiles/symengine.dir/set_funcs.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/set_funcs.cpp.o.d"
+  "/root/repo/symengine/sets.cpp" "symengine/CMakeFiles/symengine.dir/sets.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/sets.cpp.o.d"
+  "/root/repo/symengine/simplify.cpp" "symengine/CMakeFiles/symengine.dir/simplify.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/simplify.cpp.o.d"
+  "/root/repo/symengine/solve.cpp" "symengine/CMakeFiles/symengine.dir/solve.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/solve.cpp.o.d"
+  "/root/repo/symengine/sparse_matrix.cpp" "symengine/CMakeFiles/symengine.dir/sparse_matrix.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/sparse_matrix.cpp.o.d"
+  "/root/repo/symengine/symbol.cpp" "symengine/CMakeFiles/symengine.dir/symbol.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/symbol.cpp.o.d"
+  "/root/repo/symengine/symengine_rcp.cpp" "symengine/CMakeFiles/symengine.dir/symengine_rcp.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/symengine_rcp.cpp.o.d"
+  "/root/repo/symengine/test_visitors.cpp" "symengine/CMakeFiles/symengine.dir/test_visitors.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/test_visitors.cpp.o.d"
+  "/root/repo/symengine/tuple.cpp" "symengine/CMakeFiles/symengine.dir/tuple.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/tuple.cpp.o.d"
+  "/root/repo/symengine/visitor.cpp" "symengine/CMakeFiles/symengine.dir/visitor.cpp.o" "gcc" "symengine/CMakeFiles/symengine.dir/visitor.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,191 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/symengine.dir/add.cpp.o"
+  "CMakeFiles/symengine.dir/add.cpp.o.d"
+  "CMakeFiles/symengine.dir/assumptions.cpp.o"
+  "CMakeFiles/symengine.dir/assumptions.cpp.o.d"
+  "CMakeFiles/symengine.dir/basic.cpp.o"
+  "CMakeFiles/symengine.dir/basic.cpp.o.d"
+  "CMakeFiles/symengine.dir/complex.cpp.o"
+  "CMakeFiles/symengine.dir/complex.cpp.o.d"
+  "CMakeFiles/symengine.dir/complex_double.cpp.o"
+  "CMakeFiles/symengine.dir/complex_double.cpp.o.d"
+  "CMakeFiles/symengine.dir/constants.cpp.o"
+  "CMakeFiles/symengine.dir/constants.cpp.o.d"
+  "CMakeFiles/symengine.dir/cse.cpp.o"
+  "CMakeFiles/symengine.dir/cse.cpp.o.d"
+  "CMakeFiles/symengine.dir/cwrapper.cpp.o"
+  "CMakeFiles/symengine.dir/cwrapper.cpp.o.d"
+  "CMakeFiles/symengine.dir/dense_matrix.cpp.o"
+  "CMakeFiles/symengine.dir/dense_matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/derivative.cpp.o"
+  "CMakeFiles/symengine.dir/derivative.cpp.o.d"
+  "CMakeFiles/symengine.dir/dict.cpp.o"
+  "CMakeFiles/symengine.dir/dict.cpp.o.d"
+  "CMakeFiles/symengine.dir/diophantine.cpp.o"
+  "CMakeFiles/symengine.dir/diophantine.cpp.o.d"
+  "CMakeFiles/symengine.dir/eval.cpp.o"
+  "CMakeFiles/symengine.dir/eval.cpp.o.d"
+  "CMakeFiles/symengine.dir/eval_double.cpp.o"
+  "CMakeFiles/symengine.dir/eval_double.cpp.o.d"
+  "CMakeFiles/symengine.dir/expand.cpp.o"
+  "CMakeFiles/symengine.dir/expand.cpp.o.d"
+  "CMakeFiles/symengine.dir/expression.cpp.o"
+  "CMakeFiles/symengine.dir/expression.cpp.o.d"
+  "CMakeFiles/symengine.dir/fields.cpp.o"
+  "CMakeFiles/symengine.dir/fields.cpp.o.d"
+  "CMakeFiles/symengine.dir/finitediff.cpp.o"
+  "CMakeFiles/symengine.dir/finitediff.cpp.o.d"
+  "CMakeFiles/symengine.dir/functions.cpp.o"
+  "CMakeFiles/symengine.dir/functions.cpp.o.d"
+  "CMakeFiles/symengine.dir/infinity.cpp.o"
+  "CMakeFiles/symengine.dir/infinity.cpp.o.d"
+  "CMakeFiles/symengine.dir/integer.cpp.o"
+  "CMakeFiles/symengine.dir/integer.cpp.o.d"
+  "CMakeFiles/symengine.dir/intern.cpp.o"
+  "CMakeFiles/symengine.dir/intern.cpp.o.d"
+  "CMakeFiles/symengine.dir/logic.cpp.o"
+  "CMakeFiles/symengine.dir/logic.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/conjugate_matrix.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/conjugate_matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/diagonal_matrix.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/diagonal_matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/hadamard_product.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/hadamard_product.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/identity_matrix.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/identity_matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/immutable_dense_matrix.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/immutable_dense_matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_diagonal.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_diagonal.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_lower.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_lower.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_real.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_real.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_square.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_square.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_symmetric.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_symmetric.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_toeplitz.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_toeplitz.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_upper.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_upper.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/is_zero.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/is_zero.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/matrix_add.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/matrix_add.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/matrix_mul.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/matrix_mul.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/matrix_symbol.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/matrix_symbol.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/size.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/size.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/trace.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/trace.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/transpose.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/transpose.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrices/zero_matrix.cpp.o"
+  "CMakeFiles/symengine.dir/matrices/zero_matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/matrix.cpp.o"
+  "CMakeFiles/symengine.dir/matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/monomials.cpp.o"
+  "CMakeFiles/symengine.dir/monomials.cpp.o.d"
+  "CMakeFiles/symengine.dir/mp_wrapper.cpp.o"
+  "CMakeFiles/symengine.dir/mp_wrapper.cpp.o.d"
+  "CMakeFiles/symengine.dir/mul.cpp.o"
+  "CMakeFiles/symengine.dir/mul.cpp.o.d"
+  "CMakeFiles/symengine.dir/nan.cpp.o"
+  "CMakeFiles/symengine.dir/nan.cpp.o.d"
+  "CMakeFiles/symengine.dir/ntheory.cpp.o"
+  "CMakeFiles/symengine.dir/ntheory.cpp.o.d"
+  "CMakeFiles/symengine.dir/ntheory_funcs.cpp.o"
+  "CMakeFiles/symengine.dir/ntheory_funcs.cpp.o.d"
+  "CMakeFiles/symengine.dir/number.cpp.o"
+  "CMakeFiles/symengine.dir/number.cpp.o.d"
+  "CMakeFiles/symengine.dir/numer_denom.cpp.o"
+  "CMakeFiles/symengine.dir/numer_denom.cpp.o.d"
+  "CMakeFiles/symengine.dir/parser/parser.cpp.o"
+  "CMakeFiles/symengine.dir/parser/parser.cpp.o.d"
+  "CMakeFiles/symengine.dir/parser/parser.tab.cc.o"
+  "CMakeFiles/symengine.dir/parser/parser.tab.cc.o.d"
+  "CMakeFiles/symengine.dir/parser/parser_old.cpp.o"
+  "CMakeFiles/symengine.dir/parser/parser_old.cpp.o.d"
+  "CMakeFiles/symengine.dir/parser/sbml/sbml_parser.cpp.o"
+  "CMakeFiles/symengine.dir/parser/sbml/sbml_parser.cpp.o.d"
+  "CMakeFiles/symengine.dir/parser/sbml/sbml_parser.tab.cc.o"
+  "CMakeFiles/symengine.dir/parser/sbml/sbml_parser.tab.cc.o.d"
+  "CMakeFiles/symengine.dir/parser/sbml/sbml_tokenizer.cpp.o"
+  "CMakeFiles/symengine.dir/parser/sbml/sbml_tokenizer.cpp.o.d"
+  "CMakeFiles/symengine.dir/parser/tokenizer.cpp.o"
+  "CMakeFiles/symengine.dir/parser/tokenizer.cpp.o.d"
+  "CMakeFiles/symengine.dir/polys/basic_conversions.cpp.o"
+  "CMakeFiles/symengine.dir/polys/basic_conversions.cpp.o.d"
+  "CMakeFiles/symengine.dir/polys/msymenginepoly.cpp.o"
+  "CMakeFiles/symengine.dir/polys/msymenginepoly.cpp.o.d"
+  "CMakeFiles/symengine.dir/polys/uexprpoly.cpp.o"
+  "CMakeFiles/symengine.dir/polys/uexprpoly.cpp.o.d"
+  "CMakeFiles/symengine.dir/polys/uintpoly.cpp.o"
+  "CMakeFiles/symengine.dir/polys/uintpoly.cpp.o.d"
+  "CMakeFiles/symengine.dir/polys/uratpoly.cpp.o"
+  "CMakeFiles/symengine.dir/polys/uratpoly.cpp.o.d"
+  "CMakeFiles/symengine.dir/pool_allocator.cpp.o"
+  "CMakeFiles/symengine.dir/pool_allocator.cpp.o.d"
+  "CMakeFiles/symengine.dir/pow.cpp.o"
+  "CMakeFiles/symengine.dir/pow.cpp.o.d"
+  "CMakeFiles/symengine.dir/prime_sieve.cpp.o"
+  "CMakeFiles/symengine.dir/prime_sieve.cpp.o.d"
+  "CMakeFiles/symengine.dir/printers/codegen.cpp.o"
+  "CMakeFiles/symengine.dir/printers/codegen.cpp.o.d"
+  "CMakeFiles/symengine.dir/printers/latex.cpp.o"
+  "CMakeFiles/symengine.dir/printers/latex.cpp.o.d"
+  "CMakeFiles/symengine.dir/printers/mathml.cpp.o"
+  "CMakeFiles/symengine.dir/printers/mathml.cpp.o.d"
+  "CMakeFiles/symengine.dir/printers/sbml.cpp.o"
+  "CMakeFiles/symengine.dir/printers/sbml.cpp.o.d"
+  "CMakeFiles/symengine.dir/printers/stringbox.cpp.o"
+  "CMakeFiles/symengine.dir/printers/stringbox.cpp.o.d"
+  "CMakeFiles/symengine.dir/printers/strprinter.cpp.o"
+  "CMakeFiles/symengine.dir/printers/strprinter.cpp.o.d"
+  "CMakeFiles/symengine.dir/printers/unicode.cpp.o"
+  "CMakeFiles/symengine.dir/printers/unicode.cpp.o.d"
+  "CMakeFiles/symengine.dir/rational.cpp.o"
+  "CMakeFiles/symengine.dir/rational.cpp.o.d"
+  "CMakeFiles/symengine.dir/real_double.cpp.o"
+  "CMakeFiles/symengine.dir/real_double.cpp.o.d"
+  "CMakeFiles/symengine.dir/refine.cpp.o"
+  "CMakeFiles/symengine.dir/refine.cpp.o.d"
+  "CMakeFiles/symengine.dir/rewrite.cpp.o"
+  "CMakeFiles/symengine.dir/rewrite.cpp.o.d"
+  "CMakeFiles/symengine.dir/rings.cpp.o"
+  "CMakeFiles/symengine.dir/rings.cpp.o.d"
+  "CMakeFiles/symengine.dir/series.cpp.o"
+  "CMakeFiles/symengine.dir/series.cpp.o.d"
+  "CMakeFiles/symengine.dir/series_generic.cpp.o"
+  "CMakeFiles/symengine.dir/series_generic.cpp.o.d"
+  "CMakeFiles/symengine.dir/set_funcs.cpp.o"
+  "CMakeFiles/symengine.dir/set_funcs.cpp.o.d"
+  "CMakeFiles/symengine.dir/sets.cpp.o"
+  "CMakeFiles/symengine.dir/sets.cpp.o.d"
+  "CMakeFiles/symengine.dir/simplify.cpp.o"
+  "CMakeFiles/symengine.dir/simplify.cpp.o.d"
+  "CMakeFiles/symengine.dir/solve.cpp.o"
+  "CMakeFiles/symengine.dir/solve.cpp.o.d"
+  "CMakeFiles/symengine.dir/sparse_matrix.cpp.o"
+  "CMakeFiles/symengine.dir/sparse_matrix.cpp.o.d"
+  "CMakeFiles/symengine.dir/symbol.cpp.o"
+  "CMakeFiles/symengine.dir/symbol.cpp.o.d"
+  "CMakeFiles/symengine.dir/symengine_rcp.cpp.o"
+  "CMakeFiles/symengine.dir/symengine_rcp.cpp.o.d"
+  "CMakeFiles/symengine.dir/test_visitors.cpp.o"
+  "CMakeFiles/symengine.dir/test_visitors.cpp.o.d"
+  "CMakeFiles/symengine.dir/tuple.cpp.o"
+  "CMakeFiles/symengine.dir/tuple.cpp.o.d"
+  "CMakeFiles/symengine.dir/visitor.cpp.o"
+  "CMakeFiles/symengine.dir/visitor.cpp.o.d"
+  "libsymengine.a"
+  "libsymengine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/symengine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
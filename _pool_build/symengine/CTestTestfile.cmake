@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine
+# Build directory: /root/repo/_pool_build/symengine
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("utilities/matchpycpp")
+subdirs("utilities/catch")
+subdirs("tests")
+subdirs("utilities/matchpycpp/tests")
+subdirs("utilities/matchpycpp/autogen_tests")
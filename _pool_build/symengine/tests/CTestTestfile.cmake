@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests
+# Build directory: /root/repo/_pool_build/symengine/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("rcp")
+subdirs("basic")
+subdirs("ntheory")
+subdirs("matrix")
+subdirs("printing")
+subdirs("polynomial")
+subdirs("eval")
+subdirs("cwrapper")
+subdirs("expression")
+subdirs("logic")
+subdirs("finitediff")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_arit.dir/test_arit.cpp.o"
+  "CMakeFiles/test_arit.dir/test_arit.cpp.o.d"
+  "test_arit"
+  "test_arit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_arit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
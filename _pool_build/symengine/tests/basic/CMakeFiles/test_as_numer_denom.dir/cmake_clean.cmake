@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_as_numer_denom.dir/test_as_numer_denom.cpp.o"
+  "CMakeFiles/test_as_numer_denom.dir/test_as_numer_denom.cpp.o.d"
+  "test_as_numer_denom"
+  "test_as_numer_denom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_as_numer_denom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/symengine/tests/basic/test_as_real_imag.cpp" "symengine/tests/basic/CMakeFiles/test_as_real_imag.dir/test_as_real_imag.cpp.o" "gcc" "symengine/tests/basic/CMakeFiles/test_as_real_imag.dir/test_as_real_imag.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_pool_build/symengine/CMakeFiles/symengine.dir/DependInfo.cmake"
+  "/root/repo/_pool_build/symengine/utilities/catch/CMakeFiles/catch.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
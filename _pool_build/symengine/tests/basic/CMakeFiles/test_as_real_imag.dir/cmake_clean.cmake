@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_as_real_imag.dir/test_as_real_imag.cpp.o"
+  "CMakeFiles/test_as_real_imag.dir/test_as_real_imag.cpp.o.d"
+  "test_as_real_imag"
+  "test_as_real_imag.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_as_real_imag.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_assumptions.dir/test_assumptions.cpp.o"
+  "CMakeFiles/test_assumptions.dir/test_assumptions.cpp.o.d"
+  "test_assumptions"
+  "test_assumptions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_assumptions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
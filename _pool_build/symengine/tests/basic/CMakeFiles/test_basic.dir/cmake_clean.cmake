@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_basic.dir/test_basic.cpp.o"
+  "CMakeFiles/test_basic.dir/test_basic.cpp.o.d"
+  "test_basic"
+  "test_basic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_basic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_count_ops.dir/test_count_ops.cpp.o"
+  "CMakeFiles/test_count_ops.dir/test_count_ops.cpp.o.d"
+  "test_count_ops"
+  "test_count_ops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_count_ops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
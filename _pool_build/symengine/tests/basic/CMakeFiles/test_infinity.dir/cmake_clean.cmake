@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_infinity.dir/test_infinity.cpp.o"
+  "CMakeFiles/test_infinity.dir/test_infinity.cpp.o.d"
+  "test_infinity"
+  "test_infinity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_infinity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_nan.dir/test_nan.cpp.o"
+  "CMakeFiles/test_nan.dir/test_nan.cpp.o.d"
+  "test_nan"
+  "test_nan.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_nan.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_number.dir/test_number.cpp.o"
+  "CMakeFiles/test_number.dir/test_number.cpp.o.d"
+  "test_number"
+  "test_number.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_number.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_relationals.dir/test_relationals.cpp.o"
+  "CMakeFiles/test_relationals.dir/test_relationals.cpp.o.d"
+  "test_relationals"
+  "test_relationals.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_relationals.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
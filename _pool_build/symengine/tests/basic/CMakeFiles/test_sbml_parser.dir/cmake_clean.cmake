@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sbml_parser.dir/test_sbml_parser.cpp.o"
+  "CMakeFiles/test_sbml_parser.dir/test_sbml_parser.cpp.o.d"
+  "test_sbml_parser"
+  "test_sbml_parser.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sbml_parser.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
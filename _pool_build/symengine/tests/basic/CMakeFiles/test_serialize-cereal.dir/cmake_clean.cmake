@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_serialize-cereal.dir/test_serialize-cereal.cpp.o"
+  "CMakeFiles/test_serialize-cereal.dir/test_serialize-cereal.cpp.o.d"
+  "test_serialize-cereal"
+  "test_serialize-cereal.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_serialize-cereal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
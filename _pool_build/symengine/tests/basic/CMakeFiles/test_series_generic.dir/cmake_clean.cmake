@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_series_generic.dir/test_series_generic.cpp.o"
+  "CMakeFiles/test_series_generic.dir/test_series_generic.cpp.o.d"
+  "test_series_generic"
+  "test_series_generic.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_series_generic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_sets.dir/test_sets.cpp.o"
+  "CMakeFiles/test_sets.dir/test_sets.cpp.o.d"
+  "test_sets"
+  "test_sets.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_sets.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_solve.dir/test_solve.cpp.o"
+  "CMakeFiles/test_solve.dir/test_solve.cpp.o.d"
+  "test_solve"
+  "test_solve.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_solve.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_subs.dir/test_subs.cpp.o"
+  "CMakeFiles/test_subs.dir/test_subs.cpp.o.d"
+  "test_subs"
+  "test_subs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_subs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
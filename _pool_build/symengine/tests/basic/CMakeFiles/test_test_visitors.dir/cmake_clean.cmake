@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_test_visitors.dir/test_test_visitors.cpp.o"
+  "CMakeFiles/test_test_visitors.dir/test_test_visitors.cpp.o.d"
+  "test_test_visitors"
+  "test_test_visitors.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_test_visitors.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
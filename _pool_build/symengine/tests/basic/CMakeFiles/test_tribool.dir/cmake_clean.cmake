@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tribool.dir/test_tribool.cpp.o"
+  "CMakeFiles/test_tribool.dir/test_tribool.cpp.o.d"
+  "test_tribool"
+  "test_tribool.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_tribool.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
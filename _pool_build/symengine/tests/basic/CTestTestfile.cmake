@@ -0,0 +1,64 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/basic
+# Build directory: /root/repo/_pool_build/symengine/tests/basic
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_basic]=] "/root/repo/_pool_build/symengine/tests/basic/test_basic")
+set_tests_properties([=[test_basic]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_arit]=] "/root/repo/_pool_build/symengine/tests/basic/test_arit")
+set_tests_properties([=[test_arit]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;9;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_poly]=] "/root/repo/_pool_build/symengine/tests/basic/test_poly")
+set_tests_properties([=[test_poly]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;13;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_series]=] "/root/repo/_pool_build/symengine/tests/basic/test_series")
+set_tests_properties([=[test_series]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;17;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_series_generic]=] "/root/repo/_pool_build/symengine/tests/basic/test_series_generic")
+set_tests_properties([=[test_series_generic]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;21;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_functions]=] "/root/repo/_pool_build/symengine/tests/basic/test_functions")
+set_tests_properties([=[test_functions]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;41;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_subs]=] "/root/repo/_pool_build/symengine/tests/basic/test_subs")
+set_tests_properties([=[test_subs]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;45;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_integer]=] "/root/repo/_pool_build/symengine/tests/basic/test_integer")
+set_tests_properties([=[test_integer]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;49;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_rational]=] "/root/repo/_pool_build/symengine/tests/basic/test_rational")
+set_tests_properties([=[test_rational]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;53;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_relationals]=] "/root/repo/_pool_build/symengine/tests/basic/test_relationals")
+set_tests_properties([=[test_relationals]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;57;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_number]=] "/root/repo/_pool_build/symengine/tests/basic/test_number")
+set_tests_properties([=[test_number]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;61;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_as_numer_denom]=] "/root/repo/_pool_build/symengine/tests/basic/test_as_numer_denom")
+set_tests_properties([=[test_as_numer_denom]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;65;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_parser]=] "/root/repo/_pool_build/symengine/tests/basic/test_parser")
+set_tests_properties([=[test_parser]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;69;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_serialize-cereal]=] "/root/repo/_pool_build/symengine/tests/basic/test_serialize-cereal")
+set_tests_properties([=[test_serialize-cereal]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;74;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_sbml_parser]=] "/root/repo/_pool_build/symengine/tests/basic/test_sbml_parser")
+set_tests_properties([=[test_sbml_parser]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;79;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_sets]=] "/root/repo/_pool_build/symengine/tests/basic/test_sets")
+set_tests_properties([=[test_sets]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;83;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_fields]=] "/root/repo/_pool_build/symengine/tests/basic/test_fields")
+set_tests_properties([=[test_fields]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;87;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_infinity]=] "/root/repo/_pool_build/symengine/tests/basic/test_infinity")
+set_tests_properties([=[test_infinity]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;91;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_nan]=] "/root/repo/_pool_build/symengine/tests/basic/test_nan")
+set_tests_properties([=[test_nan]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;95;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_solve]=] "/root/repo/_pool_build/symengine/tests/basic/test_solve")
+set_tests_properties([=[test_solve]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;99;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_as_real_imag]=] "/root/repo/_pool_build/symengine/tests/basic/test_as_real_imag")
+set_tests_properties([=[test_as_real_imag]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;103;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_cse]=] "/root/repo/_pool_build/symengine/tests/basic/test_cse")
+set_tests_properties([=[test_cse]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;113;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_count_ops]=] "/root/repo/_pool_build/symengine/tests/basic/test_count_ops")
+set_tests_properties([=[test_count_ops]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;118;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_test_visitors]=] "/root/repo/_pool_build/symengine/tests/basic/test_test_visitors")
+set_tests_properties([=[test_test_visitors]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;122;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_assumptions]=] "/root/repo/_pool_build/symengine/tests/basic/test_assumptions")
+set_tests_properties([=[test_assumptions]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;126;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_refine]=] "/root/repo/_pool_build/symengine/tests/basic/test_refine")
+set_tests_properties([=[test_refine]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;130;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_simplify]=] "/root/repo/_pool_build/symengine/tests/basic/test_simplify")
+set_tests_properties([=[test_simplify]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;134;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_tuple]=] "/root/repo/_pool_build/symengine/tests/basic/test_tuple")
+set_tests_properties([=[test_tuple]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;138;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
+add_test([=[test_tribool]=] "/root/repo/_pool_build/symengine/tests/basic/test_tribool")
+set_tests_properties([=[test_tribool]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/basic/CMakeLists.txt;142;add_test;/root/repo/symengine/tests/basic/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cwrapper.dir/test_cwrapper.c.o"
+  "CMakeFiles/test_cwrapper.dir/test_cwrapper.c.o.d"
+  "test_cwrapper"
+  "test_cwrapper.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_cwrapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
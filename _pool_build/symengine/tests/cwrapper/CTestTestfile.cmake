@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/cwrapper
+# Build directory: /root/repo/_pool_build/symengine/tests/cwrapper
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_cwrapper]=] "/root/repo/_pool_build/symengine/tests/cwrapper/test_cwrapper")
+set_tests_properties([=[test_cwrapper]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/cwrapper/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/cwrapper/CMakeLists.txt;0;")
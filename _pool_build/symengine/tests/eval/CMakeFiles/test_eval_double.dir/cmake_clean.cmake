@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_eval_double.dir/test_eval_double.cpp.o"
+  "CMakeFiles/test_eval_double.dir/test_eval_double.cpp.o.d"
+  "test_eval_double"
+  "test_eval_double.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_eval_double.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_evalf.dir/test_evalf.cpp.o"
+  "CMakeFiles/test_evalf.dir/test_evalf.cpp.o.d"
+  "test_evalf"
+  "test_evalf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_evalf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
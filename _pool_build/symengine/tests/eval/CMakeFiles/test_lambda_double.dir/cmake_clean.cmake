@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_lambda_double.dir/test_lambda_double.cpp.o"
+  "CMakeFiles/test_lambda_double.dir/test_lambda_double.cpp.o.d"
+  "test_lambda_double"
+  "test_lambda_double.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_lambda_double.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/eval
+# Build directory: /root/repo/_pool_build/symengine/tests/eval
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_evalf]=] "/root/repo/_pool_build/symengine/tests/eval/test_evalf")
+set_tests_properties([=[test_evalf]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/eval/CMakeLists.txt;23;add_test;/root/repo/symengine/tests/eval/CMakeLists.txt;0;")
+add_test([=[test_eval_double]=] "/root/repo/_pool_build/symengine/tests/eval/test_eval_double")
+set_tests_properties([=[test_eval_double]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/eval/CMakeLists.txt;27;add_test;/root/repo/symengine/tests/eval/CMakeLists.txt;0;")
+add_test([=[test_lambda_double]=] "/root/repo/_pool_build/symengine/tests/eval/test_lambda_double")
+set_tests_properties([=[test_lambda_double]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/eval/CMakeLists.txt;31;add_test;/root/repo/symengine/tests/eval/CMakeLists.txt;0;")
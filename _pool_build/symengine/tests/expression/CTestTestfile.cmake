@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/expression
+# Build directory: /root/repo/_pool_build/symengine/tests/expression
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_expression]=] "/root/repo/_pool_build/symengine/tests/expression/test_expression")
+set_tests_properties([=[test_expression]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/expression/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/expression/CMakeLists.txt;0;")
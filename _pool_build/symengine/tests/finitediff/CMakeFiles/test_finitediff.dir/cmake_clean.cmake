@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_finitediff.dir/test_finitediff.cpp.o"
+  "CMakeFiles/test_finitediff.dir/test_finitediff.cpp.o.d"
+  "test_finitediff"
+  "test_finitediff.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_finitediff.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/finitediff
+# Build directory: /root/repo/_pool_build/symengine/tests/finitediff
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_finitediff]=] "/root/repo/_pool_build/symengine/tests/finitediff/test_finitediff")
+set_tests_properties([=[test_finitediff]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/finitediff/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/finitediff/CMakeLists.txt;0;")
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/logic
+# Build directory: /root/repo/_pool_build/symengine/tests/logic
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_logic]=] "/root/repo/_pool_build/symengine/tests/logic/test_logic")
+set_tests_properties([=[test_logic]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/logic/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/logic/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_matrixexpr.dir/test_matrixexpr.cpp.o"
+  "CMakeFiles/test_matrixexpr.dir/test_matrixexpr.cpp.o.d"
+  "test_matrixexpr"
+  "test_matrixexpr.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_matrixexpr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
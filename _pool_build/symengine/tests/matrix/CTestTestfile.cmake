@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/matrix
+# Build directory: /root/repo/_pool_build/symengine/tests/matrix
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_matrix]=] "/root/repo/_pool_build/symengine/tests/matrix/test_matrix")
+set_tests_properties([=[test_matrix]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/matrix/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/matrix/CMakeLists.txt;0;")
+add_test([=[test_matrixexpr]=] "/root/repo/_pool_build/symengine/tests/matrix/test_matrixexpr")
+set_tests_properties([=[test_matrixexpr]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/matrix/CMakeLists.txt;9;add_test;/root/repo/symengine/tests/matrix/CMakeLists.txt;0;")
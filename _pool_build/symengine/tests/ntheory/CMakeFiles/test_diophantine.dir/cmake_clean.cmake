@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_diophantine.dir/test_diophantine.cpp.o"
+  "CMakeFiles/test_diophantine.dir/test_diophantine.cpp.o.d"
+  "test_diophantine"
+  "test_diophantine.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_diophantine.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
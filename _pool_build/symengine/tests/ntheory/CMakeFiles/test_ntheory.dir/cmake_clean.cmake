@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ntheory.dir/test_ntheory.cpp.o"
+  "CMakeFiles/test_ntheory.dir/test_ntheory.cpp.o.d"
+  "test_ntheory"
+  "test_ntheory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ntheory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ntheory_funcs.dir/test_ntheory_funcs.cpp.o"
+  "CMakeFiles/test_ntheory_funcs.dir/test_ntheory_funcs.cpp.o.d"
+  "test_ntheory_funcs"
+  "test_ntheory_funcs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ntheory_funcs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
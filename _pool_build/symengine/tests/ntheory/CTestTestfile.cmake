@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/ntheory
+# Build directory: /root/repo/_pool_build/symengine/tests/ntheory
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_ntheory]=] "/root/repo/_pool_build/symengine/tests/ntheory/test_ntheory")
+set_tests_properties([=[test_ntheory]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/ntheory/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/ntheory/CMakeLists.txt;0;")
+add_test([=[test_diophantine]=] "/root/repo/_pool_build/symengine/tests/ntheory/test_diophantine")
+set_tests_properties([=[test_diophantine]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/ntheory/CMakeLists.txt;9;add_test;/root/repo/symengine/tests/ntheory/CMakeLists.txt;0;")
+add_test([=[test_ntheory_funcs]=] "/root/repo/_pool_build/symengine/tests/ntheory/test_ntheory_funcs")
+set_tests_properties([=[test_ntheory_funcs]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/ntheory/CMakeLists.txt;13;add_test;/root/repo/symengine/tests/ntheory/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_basic_conversions.dir/test_basic_conversions.cpp.o"
+  "CMakeFiles/test_basic_conversions.dir/test_basic_conversions.cpp.o.d"
+  "test_basic_conversions"
+  "test_basic_conversions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_basic_conversions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mexprpoly.dir/test_mexprpoly.cpp.o"
+  "CMakeFiles/test_mexprpoly.dir/test_mexprpoly.cpp.o.d"
+  "test_mexprpoly"
+  "test_mexprpoly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mexprpoly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_mintpoly.dir/test_mintpoly.cpp.o"
+  "CMakeFiles/test_mintpoly.dir/test_mintpoly.cpp.o.d"
+  "test_mintpoly"
+  "test_mintpoly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_mintpoly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
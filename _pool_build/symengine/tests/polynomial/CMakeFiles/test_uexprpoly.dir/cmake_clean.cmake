@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_uexprpoly.dir/test_uexprpoly.cpp.o"
+  "CMakeFiles/test_uexprpoly.dir/test_uexprpoly.cpp.o.d"
+  "test_uexprpoly"
+  "test_uexprpoly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_uexprpoly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
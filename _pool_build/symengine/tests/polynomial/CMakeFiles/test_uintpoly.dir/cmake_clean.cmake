@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_uintpoly.dir/test_uintpoly.cpp.o"
+  "CMakeFiles/test_uintpoly.dir/test_uintpoly.cpp.o.d"
+  "test_uintpoly"
+  "test_uintpoly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_uintpoly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_uratpoly.dir/test_uratpoly.cpp.o"
+  "CMakeFiles/test_uratpoly.dir/test_uratpoly.cpp.o.d"
+  "test_uratpoly"
+  "test_uratpoly.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_uratpoly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/polynomial
+# Build directory: /root/repo/_pool_build/symengine/tests/polynomial
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_uintpoly]=] "/root/repo/_pool_build/symengine/tests/polynomial/test_uintpoly")
+set_tests_properties([=[test_uintpoly]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/polynomial/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/polynomial/CMakeLists.txt;0;")
+add_test([=[test_uratpoly]=] "/root/repo/_pool_build/symengine/tests/polynomial/test_uratpoly")
+set_tests_properties([=[test_uratpoly]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/polynomial/CMakeLists.txt;9;add_test;/root/repo/symengine/tests/polynomial/CMakeLists.txt;0;")
+add_test([=[test_mintpoly]=] "/root/repo/_pool_build/symengine/tests/polynomial/test_mintpoly")
+set_tests_properties([=[test_mintpoly]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/polynomial/CMakeLists.txt;13;add_test;/root/repo/symengine/tests/polynomial/CMakeLists.txt;0;")
+add_test([=[test_uexprpoly]=] "/root/repo/_pool_build/symengine/tests/polynomial/test_uexprpoly")
+set_tests_properties([=[test_uexprpoly]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/polynomial/CMakeLists.txt;17;add_test;/root/repo/symengine/tests/polynomial/CMakeLists.txt;0;")
+add_test([=[test_mexprpoly]=] "/root/repo/_pool_build/symengine/tests/polynomial/test_mexprpoly")
+set_tests_properties([=[test_mexprpoly]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/polynomial/CMakeLists.txt;21;add_test;/root/repo/symengine/tests/polynomial/CMakeLists.txt;0;")
+add_test([=[test_basic_conversions]=] "/root/repo/_pool_build/symengine/tests/polynomial/test_basic_conversions")
+set_tests_properties([=[test_basic_conversions]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/polynomial/CMakeLists.txt;25;add_test;/root/repo/symengine/tests/polynomial/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_ccode.dir/test_ccode.cpp.o"
+  "CMakeFiles/test_ccode.dir/test_ccode.cpp.o.d"
+  "test_ccode"
+  "test_ccode.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_ccode.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/printing
+# Build directory: /root/repo/_pool_build/symengine/tests/printing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_printing]=] "/root/repo/_pool_build/symengine/tests/printing/test_printing")
+set_tests_properties([=[test_printing]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/printing/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/printing/CMakeLists.txt;0;")
+add_test([=[test_ccode]=] "/root/repo/_pool_build/symengine/tests/printing/test_ccode")
+set_tests_properties([=[test_ccode]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/printing/CMakeLists.txt;9;add_test;/root/repo/symengine/tests/printing/CMakeLists.txt;0;")
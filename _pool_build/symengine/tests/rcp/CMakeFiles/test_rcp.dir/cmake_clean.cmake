@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_rcp.dir/test_rcp.cpp.o"
+  "CMakeFiles/test_rcp.dir/test_rcp.cpp.o.d"
+  "test_rcp"
+  "test_rcp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_rcp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
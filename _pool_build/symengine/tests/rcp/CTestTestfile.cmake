@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/tests/rcp
+# Build directory: /root/repo/_pool_build/symengine/tests/rcp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_rcp]=] "/root/repo/_pool_build/symengine/tests/rcp/test_rcp")
+set_tests_properties([=[test_rcp]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/tests/rcp/CMakeLists.txt;5;add_test;/root/repo/symengine/tests/rcp/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/catch.dir/catch.cpp.o"
+  "CMakeFiles/catch.dir/catch.cpp.o.d"
+  "libcatch.a"
+  "libcatch.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/catch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/utilities/matchpycpp
+# Build directory: /root/repo/_pool_build/symengine/utilities/matchpycpp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
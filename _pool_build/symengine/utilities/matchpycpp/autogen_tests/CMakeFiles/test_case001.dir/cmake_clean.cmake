@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_case001.dir/test_case001.cpp.o"
+  "CMakeFiles/test_case001.dir/test_case001.cpp.o.d"
+  "test_case001"
+  "test_case001.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_case001.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_case002.dir/test_case002.cpp.o"
+  "CMakeFiles/test_case002.dir/test_case002.cpp.o.d"
+  "test_case002"
+  "test_case002.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_case002.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
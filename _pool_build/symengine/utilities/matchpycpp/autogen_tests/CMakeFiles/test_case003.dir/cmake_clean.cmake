@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_case003.dir/test_case003.cpp.o"
+  "CMakeFiles/test_case003.dir/test_case003.cpp.o.d"
+  "test_case003"
+  "test_case003.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_case003.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_case004.dir/test_case004.cpp.o"
+  "CMakeFiles/test_case004.dir/test_case004.cpp.o.d"
+  "test_case004"
+  "test_case004.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_case004.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_case005.dir/test_case005.cpp.o"
+  "CMakeFiles/test_case005.dir/test_case005.cpp.o.d"
+  "test_case005"
+  "test_case005.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_case005.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_case006.dir/test_case006.cpp.o"
+  "CMakeFiles/test_case006.dir/test_case006.cpp.o.d"
+  "test_case006"
+  "test_case006.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_case006.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
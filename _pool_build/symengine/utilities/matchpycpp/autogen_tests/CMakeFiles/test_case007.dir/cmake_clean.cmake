@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_case007.dir/test_case007.cpp.o"
+  "CMakeFiles/test_case007.dir/test_case007.cpp.o.d"
+  "test_case007"
+  "test_case007.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_case007.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/utilities/matchpycpp/autogen_tests
+# Build directory: /root/repo/_pool_build/symengine/utilities/matchpycpp/autogen_tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_case001]=] "test_case001")
+set_tests_properties([=[test_case001]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;11;add_test;/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;0;")
+add_test([=[test_case002]=] "test_case002")
+set_tests_properties([=[test_case002]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;15;add_test;/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;0;")
+add_test([=[test_case003]=] "test_case003")
+set_tests_properties([=[test_case003]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;19;add_test;/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;0;")
+add_test([=[test_case004]=] "test_case004")
+set_tests_properties([=[test_case004]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;23;add_test;/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;0;")
+add_test([=[test_case005]=] "test_case005")
+set_tests_properties([=[test_case005]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;27;add_test;/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;0;")
+add_test([=[test_case006]=] "test_case006")
+set_tests_properties([=[test_case006]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;31;add_test;/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;0;")
+add_test([=[test_case007]=] "test_case007")
+set_tests_properties([=[test_case007]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;35;add_test;/root/repo/symengine/utilities/matchpycpp/autogen_tests/CMakeLists.txt;0;")
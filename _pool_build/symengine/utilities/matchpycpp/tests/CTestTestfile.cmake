@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/utilities/matchpycpp/tests
+# Build directory: /root/repo/_pool_build/symengine/utilities/matchpycpp/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("bipartite")
+subdirs("hopcroft_karp")
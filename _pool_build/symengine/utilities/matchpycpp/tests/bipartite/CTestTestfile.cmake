@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/utilities/matchpycpp/tests/bipartite
+# Build directory: /root/repo/_pool_build/symengine/utilities/matchpycpp/tests/bipartite
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_bipartite]=] "test_bipartite")
+set_tests_properties([=[test_bipartite]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/tests/bipartite/CMakeLists.txt;5;add_test;/root/repo/symengine/utilities/matchpycpp/tests/bipartite/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_hopcroft_karp.dir/test_hopcroft_karp.cpp.o"
+  "CMakeFiles/test_hopcroft_karp.dir/test_hopcroft_karp.cpp.o.d"
+  "test_hopcroft_karp"
+  "test_hopcroft_karp.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test_hopcroft_karp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/symengine/utilities/matchpycpp/tests/hopcroft_karp
+# Build directory: /root/repo/_pool_build/symengine/utilities/matchpycpp/tests/hopcroft_karp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test([=[test_hopcroft_karp]=] "/root/repo/_pool_build/symengine/utilities/matchpycpp/tests/hopcroft_karp/test_hopcroft_karp")
+set_tests_properties([=[test_hopcroft_karp]=] PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/symengine/utilities/matchpycpp/tests/hopcroft_karp/CMakeLists.txt;5;add_test;/root/repo/symengine/utilities/matchpycpp/tests/hopcroft_karp/CMakeLists.txt;0;")
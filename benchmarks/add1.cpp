@@ -1,6 +1,10 @@
 #include <iostream>
 #include <chrono>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 #include <symengine/basic.h>
 #include <symengine/add.h>
 #include <symengine/symbol.h>
@@ -21,6 +25,17 @@ using SymEngine::rcp_static_cast;
 using SymEngine::Symbol;
 using SymEngine::symbol;
 
+long peak_rss_kb()
+{
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return -1;
+#endif
+}
+
 int main(int argc, char *argv[])
 {
     SymEngine::print_stack_on_segfault();
@@ -45,6 +60,7 @@ int main(int argc, char *argv[])
     assert(is_a<Add>(*a));
     std::cout << "number of terms: "
               << rcp_static_cast<const Add>(a)->get_dict().size() << std::endl;
+    std::cout << "peak RSS: " << peak_rss_kb() << " kB" << std::endl;
 
     return 0;
 }
@@ -0,0 +1,69 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+
+#include <symengine/expression.h>
+
+using SymEngine::add;
+using SymEngine::AddBuilder;
+using SymEngine::Basic;
+using SymEngine::eq;
+using SymEngine::Expression;
+using SymEngine::RCP;
+using SymEngine::vec_basic;
+
+template <typename F>
+double time_ms(F f)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// Sums i*x**i for i = 1..N term by term: with Expression::operator+= every
+// step copies the partial sum, AddBuilder and add(vec_basic) do not.
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    int N = 20000;
+    if (argc == 2) {
+        N = std::atoi(argv[1]);
+    }
+
+    Expression x("x");
+    std::vector<Expression> terms;
+    vec_basic v;
+    for (int i = 1; i <= N; i++) {
+        terms.push_back(i * pow(x, i));
+        v.push_back(terms.back());
+    }
+
+    Expression s1 = 0;
+    double t = time_ms([&] {
+        for (const auto &term : terms)
+            s1 += term;
+    });
+    std::cout << "Expression +=: " << t << "ms" << std::endl;
+
+    RCP<const Basic> s2;
+    t = time_ms([&] {
+        AddBuilder b;
+        b.reserve(terms.size());
+        for (const auto &term : terms)
+            b += term;
+        s2 = b.build();
+    });
+    std::cout << "AddBuilder:    " << t << "ms" << std::endl;
+
+    RCP<const Basic> s3;
+    t = time_ms([&] { s3 = add(v); });
+    std::cout << "add(vec):      " << t << "ms" << std::endl;
+
+    if (not eq(*s1.get_basic(), *s2) or not eq(*s2, *s3)) {
+        std::cout << "The sums differ" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <iostream>
+#include <chrono>
+
+#include <symengine/visitor.h>
+
+using SymEngine::add;
+using SymEngine::atoms;
+using SymEngine::Basic;
+using SymEngine::BaseVisitor;
+using SymEngine::count_ops;
+using SymEngine::free_symbols;
+using SymEngine::has_basic;
+using SymEngine::mul;
+using SymEngine::RCP;
+using SymEngine::rewrite_as_exp;
+using SymEngine::sin;
+using SymEngine::Symbol;
+using SymEngine::symbol;
+
+// Counts the visited nodes
+class NodeCounter : public BaseVisitor<NodeCounter>
+{
+public:
+    unsigned long count = 0;
+
+    void bvisit(const Basic &x)
+    {
+        count++;
+    }
+};
+
+template <typename F>
+double time_ms(F f)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// The expression f_{n+1} = f_n*(f_n + y) + x has O(n) distinct nodes, but
+// its tree has O(2**n) nodes, as f_n is shared by both factors.
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> z = sin(symbol("z"));
+
+    RCP<const Basic> f = x;
+    for (unsigned n = 1; n <= 40; n++) {
+        f = add(mul(f, add(f, y)), x);
+        if (n % 5 != 0)
+            continue;
+
+        std::cout << "n = " << n << std::endl;
+        NodeCounter once;
+        double t = time_ms([&] { preorder_traversal(*f, once, true); });
+        std::cout << "  preorder (once): " << once.count << " nodes, " << t
+                  << "ms" << std::endl;
+        if (n <= 20) {
+            // Visiting the whole tree is exponential in n
+            NodeCounter all;
+            t = time_ms([&] { preorder_traversal(*f, all); });
+            std::cout << "  preorder (all):  " << all.count << " nodes, " << t
+                      << "ms" << std::endl;
+        }
+        t = time_ms([&] { free_symbols(*f); });
+        std::cout << "  free_symbols:    " << t << "ms" << std::endl;
+        t = time_ms([&] { atoms<Symbol>(*f); });
+        std::cout << "  atoms:           " << t << "ms" << std::endl;
+        t = time_ms([&] { has_basic(*f, *z); });
+        std::cout << "  has_basic:       " << t << "ms" << std::endl;
+        t = time_ms([&] { count_ops({f}); });
+        std::cout << "  count_ops:       " << t << "ms" << std::endl;
+        t = time_ms([&] { rewrite_as_exp(f); });
+        std::cout << "  rewrite_as_exp:  " << t << "ms" << std::endl;
+    }
+
+    return 0;
+}
@@ -1,6 +1,10 @@
 #include <iostream>
 #include <chrono>
 
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
 #include <symengine/basic.h>
 #include <symengine/add.h>
 #include <symengine/symbol.h>
@@ -23,14 +27,30 @@ using SymEngine::Symbol;
 using SymEngine::symbol;
 using SymEngine::umap_basic_num;
 
+long peak_rss_kb()
+{
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return -1;
+#endif
+}
+
 int main(int argc, char *argv[])
 {
     int N;
-    if (argc == 2) {
+    if (argc >= 2) {
         N = std::atoi(argv[1]);
     } else {
         N = 15;
     }
+    // The number of threads, only used with OpenMP
+    unsigned threads = 1;
+    if (argc >= 3) {
+        threads = std::atoi(argv[2]);
+    }
     SymEngine::print_stack_on_segfault();
 
     RCP<const Basic> x = symbol("x");
@@ -47,7 +67,7 @@ int main(int argc, char *argv[])
     // std::cout << "Expanding: " << *f << std::endl;
 
     auto t1 = std::chrono::high_resolution_clock::now();
-    r = expand(f);
+    r = expand(f, true, threads);
     auto t2 = std::chrono::high_resolution_clock::now();
     // std::cout << *r << std::endl;
     std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1)
@@ -56,6 +76,7 @@ int main(int argc, char *argv[])
     assert(is_a<Add>(*r));
     std::cout << "number of terms: "
               << rcp_static_cast<const Add>(r)->get_dict().size() << std::endl;
+    std::cout << "peak RSS: " << peak_rss_kb() << " kB" << std::endl;
 
     return 0;
 }
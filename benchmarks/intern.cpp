@@ -0,0 +1,126 @@
+#include <iostream>
+#include <chrono>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include <symengine/basic.h>
+#include <symengine/add.h>
+#include <symengine/symbol.h>
+#include <symengine/integer.h>
+#include <symengine/mul.h>
+#include <symengine/pow.h>
+#include <symengine/intern.h>
+
+using SymEngine::add;
+using SymEngine::Basic;
+using SymEngine::expand;
+using SymEngine::Integer;
+using SymEngine::integer;
+using SymEngine::interned_count;
+using SymEngine::mul;
+using SymEngine::one;
+using SymEngine::pow;
+using SymEngine::RCP;
+using SymEngine::sub;
+using SymEngine::symbol;
+using SymEngine::vec_basic;
+using SymEngine::zero;
+
+// Usage: intern [on|off]
+//
+// Runs the `expand2` and the `symbench` R2 workloads and a workload that
+// builds many structurally equal expressions (as in large Jacobians), with
+// interning enabled or disabled. Run it twice (once with "on" and once with
+// "off") to compare the timings and the peak memory use.
+
+long peak_rss_kb()
+{
+#ifndef _WIN32
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#else
+    return -1;
+#endif
+}
+
+RCP<const Basic> hermite(RCP<const Integer> n, RCP<const Basic> y)
+{
+    if (eq(*n, *one))
+        return mul(y, integer(2));
+    if (eq(*n, *zero))
+        return one;
+    return expand(
+        sub(mul(mul(integer(2), y), hermite(n->subint(*one), y)),
+            mul(integer(2),
+                mul(n->subint(*one), hermite(n->subint(*integer(2)), y)))));
+}
+
+int main(int argc, char *argv[])
+{
+    bool enable = not(argc >= 2 and std::strcmp(argv[1], "off") == 0);
+    SymEngine::set_interning(enable);
+    SymEngine::print_stack_on_segfault();
+    std::cout << "interning: " << (enable ? "on" : "off") << std::endl;
+
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> z = symbol("z");
+    RCP<const Basic> w = symbol("w");
+
+    // expand2
+    RCP<const Basic> e = pow(add(add(add(x, y), z), w), integer(15));
+    RCP<const Basic> f = mul(e, add(e, w));
+    auto t1 = std::chrono::high_resolution_clock::now();
+    RCP<const Basic> r = expand(f);
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "expand2:   "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t2
+                                                                       - t1)
+                     .count()
+              << "ms" << std::endl;
+
+    // symbench R2
+    t1 = std::chrono::high_resolution_clock::now();
+    RCP<const Basic> g = hermite(integer(15), y);
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "R2:        "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t2
+                                                                       - t1)
+                     .count()
+              << "ms" << std::endl;
+
+    // Many equal subexpressions, as in Jacobians of large models
+    vec_basic v;
+    t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 200000; i++) {
+        RCP<const Basic> s = symbol("p" + std::to_string(i % 100));
+        v.push_back(
+            add(mul(pow(add(x, s), integer(2)), y), pow(s, integer(i % 7))));
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "jacobian:  "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t2
+                                                                       - t1)
+                     .count()
+              << "ms" << std::endl;
+    unsigned equal = 0;
+    t1 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 700; i < v.size(); i++) {
+        equal += eq(*v[i], *v[i - 700]);
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "eq:        "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(t2
+                                                                       - t1)
+                     .count()
+              << "ms (" << equal << " equal pairs)" << std::endl;
+
+    std::cout << "interned nodes: " << interned_count() << std::endl;
+    std::cout << "peak RSS: " << peak_rss_kb() << " kB" << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+
+#include <symengine/polys/cancel.h>
+#include <symengine/polys/msymenginepoly.h>
+#include <symengine/symbol.h>
+
+using SymEngine::Basic;
+using SymEngine::cancel;
+using SymEngine::gcd_mpoly;
+using SymEngine::integer_class;
+using SymEngine::MIntPoly;
+using SymEngine::mul_mpoly;
+using SymEngine::outArg;
+using SymEngine::RCP;
+using SymEngine::symbol;
+using SymEngine::umap_uvec_mpz;
+using SymEngine::vec_basic;
+using SymEngine::vec_uint;
+
+template <typename F>
+double time_ms(F f)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// 1 + a random polynomial with `terms` terms of degree at most `deg` in each
+// of the variables and positive coefficients
+RCP<const MIntPoly> random_poly(std::mt19937 &rng, const vec_basic &vars,
+                                unsigned terms, unsigned deg)
+{
+    umap_uvec_mpz d;
+    d[vec_uint(vars.size(), 0)] = integer_class(1);
+    for (unsigned i = 0; i < terms; i++) {
+        vec_uint e(vars.size());
+        for (auto &x : e)
+            x = rng() % (deg + 1);
+        d[e] += integer_class(1 + rng() % 100);
+    }
+    return MIntPoly::from_dict(vars, std::move(d));
+}
+
+// cancel(f*g / f*h) for random f, g, h in 3 to 8 variables
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    unsigned terms = 6, deg = 2;
+    if (argc >= 2) {
+        terms = std::atoi(argv[1]);
+    }
+    if (argc >= 3) {
+        deg = std::atoi(argv[2]);
+    }
+
+    std::mt19937 rng(42);
+    vec_basic vars;
+    for (unsigned n = 1; n <= 8; n++) {
+        vars.push_back(symbol("x" + std::to_string(n)));
+        if (n < 3)
+            continue;
+        RCP<const MIntPoly> f = random_poly(rng, vars, terms, deg);
+        RCP<const MIntPoly> g = random_poly(rng, vars, terms, deg);
+        RCP<const MIntPoly> h = random_poly(rng, vars, terms, deg);
+        RCP<const MIntPoly> a = mul_mpoly(*f, *g);
+        RCP<const MIntPoly> b = mul_mpoly(*f, *h);
+        RCP<const Basic> numer = a->as_symbolic();
+        RCP<const Basic> denom = b->as_symbolic();
+        std::cout << n << " variables, " << a->get_poly().dict_.size()
+                  << " / " << b->get_poly().dict_.size() << " terms"
+                  << std::endl;
+
+        RCP<const MIntPoly> r;
+        double t = time_ms([&] { r = gcd_mpoly(*a, *b); });
+        std::cout << "  gcd_mpoly: " << t << "ms" << std::endl;
+        if (not r->__eq__(*f)) {
+            std::cout << "wrong gcd " << r->__str__() << std::endl;
+            return 1;
+        }
+
+        RCP<const MIntPoly> rn, rd, c;
+        t = time_ms([&] {
+            cancel(numer, denom, outArg(rn), outArg(rd), outArg(c));
+        });
+        std::cout << "  cancel:    " << t << "ms" << std::endl;
+        if (not rn->__eq__(*g) or not rd->__eq__(*h)) {
+            std::cout << "wrong cofactors" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,83 @@
+#include <iostream>
+#include <chrono>
+
+#include <symengine/polys/msymenginepoly.h>
+
+using SymEngine::integer_class;
+using SymEngine::MIntDict;
+using SymEngine::UDictWrapper;
+using SymEngine::umap_uvec_mpz;
+using SymEngine::vec_uint;
+
+template <typename F>
+double time_ms(F f)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// The sum of the terms `c*x_i**e` given as {i, e, c}
+MIntDict sum(unsigned n, std::vector<std::vector<unsigned>> terms)
+{
+    umap_uvec_mpz d;
+    d[vec_uint(n, 0)] = integer_class(1);
+    for (const auto &t : terms) {
+        vec_uint e(n, 0);
+        e[t[0]] = t[1];
+        d[e] += integer_class(t[2]);
+    }
+    return MIntDict(std::move(d), n);
+}
+
+void run(const char *name, const MIntDict &f, const MIntDict &g)
+{
+    MIntDict p, q;
+    std::cout << name << ": " << f.dict_.size() << " x " << g.dict_.size()
+              << " terms" << std::endl;
+    double t = time_ms([&] {
+        MIntDict r = MIntDict::mul(f, g);
+        p.dict_.swap(r.dict_);
+    });
+    std::cout << "  heap:    " << t << "ms, " << p.dict_.size() << " terms"
+              << std::endl;
+    t = time_ms([&] {
+        MIntDict r = UDictWrapper<vec_uint, integer_class, MIntDict>::mul(f, g);
+        q.dict_.swap(r.dict_);
+    });
+    std::cout << "  generic: " << t << "ms" << std::endl;
+    if (p != q)
+        std::cout << "  the products differ" << std::endl;
+}
+
+// Fateman's dense benchmark f*(f+1) for f = (1+x+y+z+t)**N, and Monagan and
+// Pearce's sparse benchmark f*g for f = (1+x+y+2z**2+3t**3+5u**5)**M and
+// g = (1+u+t+2z**2+3y**3+5x**5)**M
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    unsigned N = 12, M = 8;
+    if (argc >= 2) {
+        N = std::atoi(argv[1]);
+    }
+    if (argc >= 3) {
+        M = std::atoi(argv[2]);
+    }
+
+    MIntDict f = MIntDict::pow(sum(4, {{0, 1, 1}, {1, 1, 1}, {2, 1, 1},
+                                       {3, 1, 1}}),
+                               N);
+    MIntDict g = f + sum(4, {});
+    run("dense", f, g);
+
+    f = MIntDict::pow(sum(5, {{0, 1, 1}, {1, 1, 1}, {2, 2, 2}, {3, 3, 3},
+                              {4, 5, 5}}),
+                      M);
+    g = MIntDict::pow(sum(5, {{4, 1, 1}, {3, 1, 1}, {2, 2, 2}, {1, 3, 3},
+                              {0, 5, 5}}),
+                      M);
+    run("sparse", f, g);
+    return 0;
+}
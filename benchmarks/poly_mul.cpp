@@ -0,0 +1,87 @@
+#include <iostream>
+#include <chrono>
+
+#include <symengine/add.h>
+#include <symengine/integer.h>
+#include <symengine/monomials.h>
+#include <symengine/pow.h>
+#include <symengine/rings.h>
+#include <symengine/symbol.h>
+
+using SymEngine::add;
+using SymEngine::Basic;
+using SymEngine::expr2poly;
+using SymEngine::integer;
+using SymEngine::monomial_mul;
+using SymEngine::poly_mul;
+using SymEngine::RCP;
+using SymEngine::symbol;
+using SymEngine::umap_basic_num;
+using SymEngine::umap_vec_mpz;
+using SymEngine::vec_int;
+
+template <typename F>
+double time_ms(F f)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// Fateman's benchmark f*(f + w) for f = (x + y + z + w)**N as in expand2b,
+// with poly_mul on 1 to 32 threads
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    int N = 15;
+    if (argc >= 2) {
+        N = std::atoi(argv[1]);
+    }
+
+    RCP<const Basic> x = symbol("x"), y = symbol("y"), z = symbol("z"),
+                     w = symbol("w");
+    RCP<const Basic> e = pow(add(add(add(x, y), z), w), integer(N));
+    RCP<const Basic> f1 = expand(e);
+    RCP<const Basic> f2 = expand(add(e, w));
+
+    umap_basic_num syms;
+    insert(syms, x, integer(0));
+    insert(syms, y, integer(1));
+    insert(syms, z, integer(2));
+    insert(syms, w, integer(3));
+    umap_vec_mpz P1, P2;
+    expr2poly(f1, syms, P1);
+    expr2poly(f2, syms, P2);
+    std::cout << P1.size() << " x " << P2.size() << " terms" << std::endl;
+
+    // The unpacked loop poly_mul used to run
+    umap_vec_mpz R;
+    double t = time_ms([&] {
+        vec_int exp(4, 0);
+        for (const auto &a : P1) {
+            for (const auto &b : P2) {
+                monomial_mul(a.first, b.first, exp);
+                mp_addmul(R[exp], a.second, b.second);
+            }
+        }
+    });
+    std::cout << "unpacked:   " << t << "ms" << std::endl;
+
+#ifndef _OPENMP
+    std::cout << "(built without OpenMP, poly_mul uses one thread)"
+              << std::endl;
+#endif
+    for (unsigned threads = 1; threads <= 32; threads *= 2) {
+        umap_vec_mpz C;
+        t = time_ms([&] { poly_mul(P1, P2, C, threads); });
+        std::cout << threads << " threads: " << (threads < 10 ? " " : "")
+                  << t << "ms" << std::endl;
+        if (C != R) {
+            std::cout << "the products differ" << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <algorithm>
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <symengine/add.h>
+#include <symengine/pow.h>
+#include <symengine/symbol.h>
+#include <symengine/integer.h>
+
+using SymEngine::add;
+using SymEngine::Basic;
+using SymEngine::expand;
+using SymEngine::integer;
+using SymEngine::pow;
+using SymEngine::RCP;
+using SymEngine::symbol;
+using SymEngine::vec_basic;
+
+// Runs f(i) in n threads, f returns the time it spent in copy_nodes()
+template <typename F>
+double run_threads(unsigned n, F f)
+{
+    std::vector<double> times(n);
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < n; i++) {
+        threads.emplace_back([&times, &f, i]() { times[i] = f(i); });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    return *std::max_element(times.begin(), times.end());
+}
+
+// Copies and drops the nodes `v` `reps` times
+double copy_nodes(const vec_basic &v, unsigned reps)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (unsigned r = 0; r < reps; r++) {
+        vec_basic copy(v);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// The terms of (x + y + z + 1)**15 in new symbols
+vec_basic make_nodes()
+{
+    RCP<const Basic> x = symbol("x"), y = symbol("y"), z = symbol("z");
+    return expand(pow(add(add(add(x, y), z), integer(1)), integer(15)))
+        ->get_args();
+}
+
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    unsigned n = std::thread::hardware_concurrency();
+    if (argc == 2) {
+        n = std::atoi(argv[1]);
+    }
+    if (n == 0) {
+        n = 1;
+    }
+    const unsigned reps = 20000;
+
+    vec_basic v = make_nodes();
+    std::cout << "threads: " << n << std::endl;
+
+    // Every thread copies the nodes of an expression shared by all threads
+    double t = run_threads(n, [&](unsigned) { return copy_nodes(v, reps); });
+    std::cout << "shared expression:     " << t << "ms" << std::endl;
+
+    // Every thread copies the nodes of an expression it created
+    t = run_threads(n,
+                    [&](unsigned) { return copy_nodes(make_nodes(), reps); });
+    std::cout << "per thread expression: " << t << "ms" << std::endl;
+
+    return 0;
+}
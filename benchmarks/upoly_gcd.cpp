@@ -0,0 +1,110 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+
+#include <symengine/polys/uintpoly.h>
+#include <symengine/polys/uratpoly.h>
+#include <symengine/polys/uintpoly_flint.h>
+#include <symengine/symbol.h>
+
+using SymEngine::Basic;
+using SymEngine::gcd_upoly;
+using SymEngine::integer_class;
+using SymEngine::map_uint_mpq;
+using SymEngine::map_uint_mpz;
+using SymEngine::rational_class;
+using SymEngine::RCP;
+using SymEngine::symbol;
+using SymEngine::UIntDict;
+using SymEngine::UIntPoly;
+using SymEngine::URatPoly;
+#ifdef HAVE_SYMENGINE_FLINT
+using SymEngine::UIntPolyFlint;
+#endif
+
+template <typename F>
+double time_ms(F f)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// A dense polynomial of degree n with random `bits` bit coefficients
+UIntDict random_poly(std::mt19937_64 &rng, unsigned n, unsigned bits)
+{
+    map_uint_mpz d;
+    for (unsigned i = 0; i <= n; i++) {
+        integer_class c(0);
+        for (unsigned b = 0; b < bits; b += 32) {
+            c <<= 32;
+            c += integer_class(static_cast<unsigned long>(rng() >> 32));
+        }
+        if (rng() % 2 == 0)
+            c = -c;
+        if (c != 0)
+            d[i] = c;
+    }
+    d[n] = integer_class(1) + mp_abs(d[n]);
+    return UIntDict(d);
+}
+
+// gcd(f*g, f*h) for random f, g, h of degree N
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    unsigned N = 100, bits = 64;
+    if (argc >= 2) {
+        N = std::atoi(argv[1]);
+    }
+    if (argc >= 3) {
+        bits = std::atoi(argv[2]);
+    }
+
+    std::mt19937_64 rng(42);
+    RCP<const Basic> x = symbol("x");
+    UIntDict f = random_poly(rng, N, bits);
+    UIntDict g = random_poly(rng, N, bits);
+    UIntDict h = random_poly(rng, N, bits);
+    RCP<const UIntPoly> a = UIntPoly::from_container(x, f * g);
+    RCP<const UIntPoly> b = UIntPoly::from_container(x, f * h);
+    std::cout << "degree " << 2 * N << ", " << bits
+              << " bit coefficients in the factors" << std::endl;
+
+    RCP<const UIntPoly> r;
+    double t = time_ms([&] { r = gcd_upoly(*a, *b); });
+    std::cout << "UIntPoly:      " << t << "ms" << std::endl;
+    if (r->get_degree() != static_cast<int>(N)) {
+        std::cout << "wrong gcd degree " << r->get_degree() << std::endl;
+        return 1;
+    }
+
+    map_uint_mpq ad, bd;
+    for (const auto &p : a->get_dict())
+        ad[p.first] = rational_class(p.second) / 3;
+    for (const auto &p : b->get_dict())
+        bd[p.first] = rational_class(p.second) / 7;
+    RCP<const URatPoly> ra = URatPoly::from_dict(x, std::move(ad));
+    RCP<const URatPoly> rb = URatPoly::from_dict(x, std::move(bd));
+    RCP<const URatPoly> rr;
+    t = time_ms([&] { rr = gcd_upoly(*ra, *rb); });
+    std::cout << "URatPoly:      " << t << "ms" << std::endl;
+
+#ifdef HAVE_SYMENGINE_FLINT
+    RCP<const UIntPolyFlint> fa = UIntPolyFlint::from_poly(*a);
+    RCP<const UIntPolyFlint> fb = UIntPolyFlint::from_poly(*b);
+    RCP<const UIntPolyFlint> fr;
+    t = time_ms([&] { fr = gcd_upoly(*fa, *fb); });
+    std::cout << "UIntPolyFlint: " << t << "ms" << std::endl;
+    if (not fr->__eq__(*UIntPolyFlint::from_poly(*r))) {
+        std::cout << "the gcds differ" << std::endl;
+        return 1;
+    }
+#else
+    std::cout << "UIntPolyFlint: not available (build with WITH_FLINT=yes)"
+              << std::endl;
+#endif
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include <iostream>
+#include <chrono>
+#include <random>
+
+#include <symengine/polys/uintpoly.h>
+#include <symengine/symbol.h>
+
+using SymEngine::integer_class;
+using SymEngine::map_uint_mpz;
+using SymEngine::pow_upoly;
+using SymEngine::RCP;
+using SymEngine::symbol;
+using SymEngine::UIntDict;
+using SymEngine::UIntPoly;
+
+template <typename F>
+double time_ms(F f)
+{
+    auto t1 = std::chrono::high_resolution_clock::now();
+    f();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(t2 - t1).count();
+}
+
+// A dense polynomial of degree n with random `bits` bit coefficients
+UIntDict random_poly(std::mt19937_64 &rng, unsigned n, unsigned bits)
+{
+    map_uint_mpz d;
+    for (unsigned i = 0; i <= n; i++) {
+        integer_class c(0);
+        for (unsigned b = 0; b < bits; b += 32) {
+            c <<= 32;
+            c += integer_class(static_cast<unsigned long>(rng() >> 32));
+        }
+        c >>= (bits + 31) / 32 * 32 - bits;
+        if (rng() % 2 == 0)
+            c = -c;
+        if (c != 0)
+            d[i] = c;
+    }
+    d[n] = integer_class(1) + mp_abs(d[n]);
+    return UIntDict(d);
+}
+
+// f*g for random dense f, g of degrees 16 to 2**16 and coefficients of 8 and
+// 64 bits, and to 2**14 with 512 bits, and (1 + x + x**2)**N by pow_upoly
+int main(int argc, char *argv[])
+{
+    SymEngine::print_stack_on_segfault();
+
+    unsigned N = 1000;
+    if (argc >= 2) {
+        N = std::atoi(argv[1]);
+    }
+
+    std::mt19937_64 rng(42);
+    for (unsigned bits : {8u, 64u, 512u}) {
+        std::cout << bits << " bit coefficients" << std::endl;
+        unsigned max_degree = bits > 64 ? 16384 : 65536;
+        for (unsigned n = 16; n <= max_degree; n *= 4) {
+            UIntDict f = random_poly(rng, n, bits);
+            UIntDict g = random_poly(rng, n, bits);
+            UIntDict r;
+            double t = time_ms([&] { r = UIntDict::mul(f, g); });
+            std::cout << "  degree " << n << ": " << t << "ms" << std::endl;
+        }
+    }
+
+    RCP<const UIntPoly> p = UIntPoly::from_dict(
+        symbol("x"), {{0, integer_class(1)}, {1, integer_class(1)},
+                      {2, integer_class(1)}});
+    RCP<const UIntPoly> r;
+    double t = time_ms([&] { r = pow_upoly(*p, N); });
+    std::cout << "(1 + x + x**2)**" << N << ": " << t << "ms" << std::endl;
+    return 0;
+}
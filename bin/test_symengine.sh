@@ -112,6 +112,9 @@ fi
 if [[ "${WITH_SYMENGINE_THREAD_SAFE}" != "" ]]; then
     cmake_line="$cmake_line -DWITH_SYMENGINE_THREAD_SAFE=${WITH_SYMENGINE_THREAD_SAFE}"
 fi
+if [[ "${WITH_SYMENGINE_POOL_ALLOCATOR}" != "" ]]; then
+    cmake_line="$cmake_line -DWITH_SYMENGINE_POOL_ALLOCATOR=${WITH_SYMENGINE_POOL_ALLOCATOR}"
+fi
 if [[ "${WITH_ECM}" != "" ]]; then
     cmake_line="$cmake_line -DWITH_ECM=${WITH_ECM}"
 fi
@@ -14,6 +14,7 @@
 #include <symengine/add.h>
 #include <symengine/pow.h>
 #include <symengine/complex.h>
+#include <symengine/intern.h>
 
 namespace SymEngine
 {
@@ -153,60 +154,62 @@ RCP<const Basic> Add::from_dict(const RCP<const Number> &coef,
             }
             if (is_a<Mul>(*(p->first))) {
 #if !defined(WITH_SYMENGINE_THREAD_SAFE) && defined(WITH_SYMENGINE_RCP)
-                if (down_cast<const Mul &>(*(p->first)).use_count() == 1) {
+                if (down_cast<const Mul &>(*(p->first)).use_count() == 1
+                    and not p->first->is_interned()) {
                     // We can steal the dictionary:
                     // Cast away const'ness, so that we can move 'dict_', since
                     // 'p->first' will be destroyed when 'd' is at the end of
                     // this function, so we "steal" its dict_ to avoid an
                     // unnecessary copy. We know the refcount_ is one, so
                     // nobody else is using the Mul except us.
-                    const map_basic_basic &d2
+                    const fmap_basic_basic &d2
                         = down_cast<const Mul &>(*(p->first)).get_dict();
-                    map_basic_basic &d3 = const_cast<map_basic_basic &>(d2);
+                    fmap_basic_basic &d3 = const_cast<fmap_basic_basic &>(d2);
                     return Mul::from_dict(p->second, std::move(d3));
                 } else {
 #else
                 {
 #endif
                     // We need to copy the dictionary:
-                    map_basic_basic d2
+                    fmap_basic_basic d2
                         = down_cast<const Mul &>(*(p->first)).get_dict();
                     return Mul::from_dict(
                         p->second,
                         std::move(d2)); // Can return a Pow object here
                 }
             }
-            map_basic_basic m;
+            fmap_basic_basic m;
             if (is_a<Pow>(*(p->first))) {
                 insert(m, down_cast<const Pow &>(*(p->first)).get_base(),
                        down_cast<const Pow &>(*(p->first)).get_exp());
             } else {
                 insert(m, p->first, one);
             }
-            return make_rcp<const Mul>(p->second,
-                                       std::move(m)); // Returns a Mul from here
+            return intern(make_rcp<const Mul>(
+                p->second, std::move(m))); // Returns a Mul from here
         }
-        map_basic_basic m;
+        fmap_basic_basic m;
         if (is_a_Number(*p->second)) {
             if (is_a<Mul>(*(p->first))) {
 #if !defined(WITH_SYMENGINE_THREAD_SAFE) && defined(WITH_SYMENGINE_RCP)
-                if (down_cast<const Mul &>(*(p->first)).use_count() == 1) {
+                if (down_cast<const Mul &>(*(p->first)).use_count() == 1
+                    and not p->first->is_interned()) {
                     // We can steal the dictionary:
                     // Cast away const'ness, so that we can move 'dict_', since
                     // 'p->first' will be destroyed when 'd' is at the end of
                     // this function, so we "steal" its dict_ to avoid an
                     // unnecessary copy. We know the refcount_ is one, so
                     // nobody else is using the Mul except us.
-                    const map_basic_basic &d2
+                    const fmap_basic_basic &d2
                         = down_cast<const Mul &>(*(p->first)).get_dict();
-                    map_basic_basic &d3 = const_cast<map_basic_basic &>(d2);
+                    fmap_basic_basic &d3 = const_cast<fmap_basic_basic &>(d2);
                     return Mul::from_dict(p->second, std::move(d3));
                 } else {
 #else
                 {
 #endif
                     // We need to copy the dictionary:
-                    map_basic_basic d2
+                    fmap_basic_basic d2
                         = down_cast<const Mul &>(*(p->first)).get_dict();
                     return Mul::from_dict(p->second,
                                           std::move(d2)); // May return a Pow
@@ -218,14 +221,15 @@ RCP<const Basic> Add::from_dict(const RCP<const Number> &coef,
             } else {
                 insert(m, p->first, one);
             }
-            return make_rcp<const Mul>(p->second, std::move(m));
+            return intern(make_rcp<const Mul>(p->second, std::move(m)));
         } else {
             insert(m, p->first, one);
             insert(m, p->second, one);
-            return make_rcp<const Mul>(one, std::move(m));
+            return intern(make_rcp<const Mul>(one, std::move(m)));
         }
     } else {
-        return make_rcp<const Add>(coef, std::move(d)); // returns an Add
+        return intern(
+            make_rcp<const Add>(coef, std::move(d))); // returns an Add
     }
 }
 
@@ -243,7 +247,13 @@ void Add::dict_add_term(umap_basic_num &d, const RCP<const Number> &coef,
         if (not(coef->is_zero()))
             insert(d, t, coef);
     } else {
-        iaddnum(outArg(it->second), coef);
+        // Very common case, needs to be fast:
+        if (is_a<Integer>(*it->second) and is_a<Integer>(*coef)) {
+            it->second = down_cast<const Integer &>(*it->second)
+                             .addint(down_cast<const Integer &>(*coef));
+        } else {
+            iaddnum(outArg(it->second), coef);
+        }
         if (it->second->is_zero())
             d.erase(it);
     }
@@ -311,7 +321,7 @@ void Add::as_coef_term(const RCP<const Basic> &self,
         if (neq(*(down_cast<const Mul &>(*self).get_coef()), *one)) {
             *coef = (down_cast<const Mul &>(*self)).get_coef();
             // We need to copy our 'dict_' here, as 'term' has to have its own.
-            map_basic_basic d2 = (down_cast<const Mul &>(*self)).get_dict();
+            fmap_basic_basic d2 = (down_cast<const Mul &>(*self)).get_dict();
             *term = Mul::from_dict(one, std::move(d2));
         } else {
             *coef = one;
@@ -413,6 +423,49 @@ vec_basic Add::get_args() const
     return args;
 }
 
+void Add::for_each_arg(const arg_callback &f) const
+{
+    if (not coef_->is_zero())
+        f(coef_);
+    for (const auto &p : dict_) {
+        if (eq(*p.second, *one)) {
+            f(p.first);
+        } else {
+            f(Add::from_dict(zero, {{p.first, p.second}}));
+        }
+    }
+}
+
+AddBuilder::AddBuilder() : coef_(zero) {}
+
+AddBuilder &AddBuilder::operator+=(const RCP<const Basic> &term)
+{
+    Add::coef_dict_add_term(outArg(coef_), dict_, one, term);
+    return *this;
+}
+
+void AddBuilder::add_term(const RCP<const Number> &coef,
+                          const RCP<const Basic> &term)
+{
+    if (is_a<Add>(*term) and not coef->is_one()) {
+        // Distribute `coef`, so that no `Add` ends up as a term
+        const Add &a = down_cast<const Add &>(*term);
+        iaddnum(outArg(coef_), mulnum(coef, a.get_coef()));
+        for (const auto &p : a.get_dict())
+            Add::dict_add_term(dict_, mulnum(coef, p.second), p.first);
+    } else {
+        Add::coef_dict_add_term(outArg(coef_), dict_, coef, term);
+    }
+}
+
+RCP<const Basic> AddBuilder::build()
+{
+    RCP<const Basic> r = Add::from_dict(coef_, std::move(dict_));
+    coef_ = zero;
+    dict_.clear();
+    return r;
+}
+
 /**
  * @details This implementation is slower than the methods of `Add`, however it
  *  is conceptually simpler and also safer, as it is more general and can
@@ -480,12 +533,12 @@ RCP<const Basic> add(const RCP<const Basic> &a, const RCP<const Basic> &b)
  */
 RCP<const Basic> add(const vec_basic &a)
 {
-    SymEngine::umap_basic_num d;
-    RCP<const Number> coef = zero;
+    AddBuilder b;
+    b.reserve(a.size());
     for (const auto &i : a) {
-        Add::coef_dict_add_term(outArg(coef), d, one, i);
+        b += i;
     }
-    return Add::from_dict(coef, std::move(d));
+    return b.build();
 }
 
 /**
@@ -137,6 +137,7 @@ public:
      * @return list of arguments.
      */
     vec_basic get_args() const override;
+    void for_each_arg(const arg_callback &f) const override;
 
     //!< @return const reference to the coefficient of the `Add`.
     inline const RCP<const Number> &get_coef() const
@@ -151,6 +152,49 @@ public:
     }
 };
 
+/**
+ *  @class AddBuilder
+ *  @brief Accumulates a sum in place.
+ *
+ *  Summing `n` terms one by one with `add(a, b)` (or `Expression::operator+=`)
+ *  copies the dictionary of the partial sum at every step, which is quadratic
+ *  in `n`. The builder collects the terms and the numeric coefficient in a
+ *  single dictionary and creates the canonical expression once at the end:
+ *
+ *      AddBuilder b;
+ *      for (const auto &term : terms)
+ *          b += term;
+ *      RCP<const Basic> sum = b.build();
+ *
+ *  An `Expression` can be added directly (it converts to `RCP<const Basic>`).
+ **/
+class AddBuilder
+{
+private:
+    RCP<const Number> coef_;
+    umap_basic_num dict_;
+
+public:
+    AddBuilder();
+
+    //! Adds `term` to the sum
+    AddBuilder &operator+=(const RCP<const Basic> &term);
+    //! Adds `coef*term` to the sum
+    void add_term(const RCP<const Number> &coef, const RCP<const Basic> &term);
+
+    //! Makes room for `n` non-numeric terms
+    inline void reserve(size_t n)
+    {
+        dict_.reserve(n);
+    }
+
+    /**
+     *  @return the sum of all the terms added so far, in canonical form.
+     *  The builder is empty (zero) afterwards.
+     */
+    RCP<const Basic> build();
+};
+
 /**
  *  @brief Adds two objects (safely).
  *  @param a is a `Basic` object.
@@ -58,6 +58,13 @@ std::string type_code_name(TypeID id);
 
 class Visitor;
 class Symbol;
+class Basic;
+
+//! Removes `b` from the unique table of interned nodes (see intern.h)
+void unintern(const Basic &b);
+
+//! Function called on every argument by `Basic::for_each_arg()`
+typedef std::function<void(const RCP<const Basic> &)> arg_callback;
 
 /**
  *  @class Basic
@@ -106,6 +113,13 @@ private:
 #else
     mutable hash_t hash_; // This holds the hash value
 #endif // WITH_SYMENGINE_THREAD_SAFE
+    // True if this instance is stored in the unique table (see intern.h).
+    // It is only set before the node is published in the table and it is
+    // never reset, so it does not need to be atomic.
+    mutable bool interned_;
+    friend RCP<const Basic> intern_basic(const RCP<const Basic> &x);
+    friend void unintern(const Basic &b);
+
 public:
 #ifdef WITH_SYMENGINE_VIRTUAL_TYPEID
     virtual TypeID get_type_code() const = 0;
@@ -117,10 +131,14 @@ public:
     };
 #endif
     //! Constructor
-    Basic() : hash_{0} {}
+    Basic() : hash_{0}, interned_{false} {}
     // Destructor must be explicitly defined as virtual here to avoid problems
     // with undefined behavior while deallocating derived classes.
-    virtual ~Basic() {}
+    virtual ~Basic()
+    {
+        if (interned_)
+            unintern(*this);
+    }
 
     //! Delete the copy constructor and assignment
     Basic(const Basic &) = delete;
@@ -152,6 +170,12 @@ public:
      */
     hash_t hash() const;
 
+    //! \return true if this instance is shared through the unique table
+    inline bool is_interned() const
+    {
+        return interned_;
+    }
+
     /**
      * @brief Test equality
      *
@@ -201,6 +225,14 @@ public:
     //! Returns the list of arguments
     virtual vec_basic get_args() const = 0;
 
+    //! Calls `f` on every argument, in the order of `get_args()`, without
+    //! building the vector. Classes that store their arguments override it.
+    virtual void for_each_arg(const arg_callback &f) const
+    {
+        for (const auto &a : get_args())
+            f(a);
+    }
+
     SYMENGINE_INCLUDE_METHODS_BASE()
 
     RCP<const Basic> diff(const RCP<const Symbol> &x, bool cache = true) const;
@@ -266,8 +298,14 @@ bool is_a_sub(const Basic &b);
 //! Returns true if `a` and `b` are exactly the same type `T`.
 bool is_same_type(const Basic &a, const Basic &b);
 
-//! Expands `self`
-RCP<const Basic> expand(const RCP<const Basic> &self, bool deep = true);
+/*! Expands `self`
+ *  With OpenMP, products of large sums are expanded by `num_threads` threads
+ *  (0 for the OpenMP default). The threads add up the products in their own
+ *  dictionaries, which are merged in a fixed order, so the result does not
+ *  depend on the scheduling.
+ */
+RCP<const Basic> expand(const RCP<const Basic> &self, bool deep = true,
+                        unsigned num_threads = 1);
 void as_numer_denom(const RCP<const Basic> &x,
                     const Ptr<RCP<const Basic>> &numer,
                     const Ptr<RCP<const Basic>> &denom);
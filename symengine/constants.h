@@ -47,6 +47,7 @@ public:
     {
         return {};
     }
+    void for_each_arg(const arg_callback &f) const override {}
 };
 
 //! inline version to return `Constant`
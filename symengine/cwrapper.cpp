@@ -1171,14 +1171,23 @@ CWRAPPER_OUTPUT_TYPE basic_min(basic s, const CVecBasic *d)
 CWRAPPER_OUTPUT_TYPE basic_add_vec(basic s, const CVecBasic *d)
 {
     CWRAPPER_BEGIN
-    basic_rcp(s) = SymEngine::add(d->m);
+    SymEngine::AddBuilder b;
+    b.reserve(d->m.size());
+    for (const auto &term : d->m) {
+        b += term;
+    }
+    basic_rcp(s) = b.build();
     CWRAPPER_END
 }
 
 CWRAPPER_OUTPUT_TYPE basic_mul_vec(basic s, const CVecBasic *d)
 {
     CWRAPPER_BEGIN
-    basic_rcp(s) = SymEngine::mul(d->m);
+    SymEngine::MulBuilder b;
+    for (const auto &factor : d->m) {
+        b *= factor;
+    }
+    basic_rcp(s) = b.build();
     CWRAPPER_END
 }
 
@@ -460,7 +460,7 @@ void DiffVisitor::bvisit(const Mul &self)
         if (is_a<Integer>(*factor)
             && down_cast<const Integer &>(*factor).is_zero())
             continue;
-        map_basic_basic d = self.get_dict();
+        fmap_basic_basic d = self.get_dict();
         d.erase(p.first);
         if (is_a_Number(*factor)) {
             imulnum(outArg(coef), rcp_static_cast<const Number>(factor));
@@ -74,6 +74,12 @@ std::ostream &operator<<(std::ostream &out, const SymEngine::map_basic_basic &d)
     return SymEngine::print_map_rcp(out, d);
 }
 
+std::ostream &operator<<(std::ostream &out,
+                         const SymEngine::fmap_basic_basic &d)
+{
+    return SymEngine::print_map_rcp(out, d);
+}
+
 std::ostream &operator<<(std::ostream &out,
                          const SymEngine::umap_basic_basic &d)
 {
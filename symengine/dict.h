@@ -7,6 +7,8 @@
 #ifndef SYMENGINE_DICT_H
 #define SYMENGINE_DICT_H
 #include <symengine/mp_class.h>
+#include <symengine/flat_hash_map.h>
+#include <symengine/flat_map.h>
 #include <algorithm>
 #include <cstdint>
 #include <map>
@@ -30,8 +32,8 @@ struct RCPIntegerKeyLess;
 
 bool eq(const Basic &, const Basic &);
 typedef uint64_t hash_t;
-typedef std::unordered_map<RCP<const Basic>, RCP<const Number>, RCPBasicHash,
-                           RCPBasicKeyEq>
+typedef FlatHashMap<RCP<const Basic>, RCP<const Number>, RCPBasicHash,
+                    RCPBasicKeyEq>
     umap_basic_num;
 typedef std::unordered_map<short, RCP<const Basic>> umap_short_basic;
 typedef std::unordered_map<int, RCP<const Basic>> umap_int_basic;
@@ -55,6 +57,10 @@ typedef std::map<RCP<const Basic>, RCP<const Number>, RCPBasicKeyLess>
     map_basic_num;
 typedef std::map<RCP<const Basic>, RCP<const Basic>, RCPBasicKeyLess>
     map_basic_basic;
+//! Sorted vector with the ordering of `map_basic_basic`, used for the
+//! (usually small) dictionary of `Mul`
+typedef FlatMap<RCP<const Basic>, RCP<const Basic>, RCPBasicKeyLess>
+    fmap_basic_basic;
 typedef std::map<RCP<const Integer>, unsigned, RCPIntegerKeyLess>
     map_integer_uint;
 typedef std::map<unsigned, integer_class> map_uint_mpz;
@@ -72,8 +78,7 @@ struct vec_hash {
 
 typedef std::unordered_map<vec_uint, integer_class, vec_hash<vec_uint>>
     umap_uvec_mpz;
-typedef std::unordered_map<vec_int, integer_class, vec_hash<vec_int>>
-    umap_vec_mpz;
+typedef FlatHashMap<vec_int, integer_class, vec_hash<vec_int>> umap_vec_mpz;
 typedef std::unordered_map<vec_int, Expression, vec_hash<vec_int>>
     umap_vec_expr;
 //! `insert(m, first, second)` is equivalent to `m[first] = second`, just
@@ -127,6 +132,12 @@ inline bool unified_eq(const std::map<K, V, C> &a, const std::map<K, V, C> &b)
     return ordered_eq(a, b);
 }
 
+template <typename K, typename V, typename C>
+inline bool unified_eq(const FlatMap<K, V, C> &a, const FlatMap<K, V, C> &b)
+{
+    return ordered_eq(a, b);
+}
+
 template <typename K, typename V, typename H, typename E>
 inline bool unified_eq(const std::unordered_map<K, V, H, E> &a,
                        const std::unordered_map<K, V, H, E> &b)
@@ -134,6 +145,13 @@ inline bool unified_eq(const std::unordered_map<K, V, H, E> &a,
     return unordered_eq(a, b);
 }
 
+template <typename K, typename V, typename H, typename E>
+inline bool unified_eq(const FlatHashMap<K, V, H, E> &a,
+                       const FlatHashMap<K, V, H, E> &b)
+{
+    return unordered_eq(a, b);
+}
+
 template <typename T, typename U,
           typename = enable_if_t<std::is_base_of<Basic, T>::value
                                  and std::is_base_of<Basic, U>::value>>
@@ -257,6 +275,13 @@ inline int unified_compare(const std::map<K, V, C> &a,
     return ordered_compare(a, b);
 }
 
+template <typename K, typename V, typename C>
+inline int unified_compare(const FlatMap<K, V, C> &a,
+                           const FlatMap<K, V, C> &b)
+{
+    return ordered_compare(a, b);
+}
+
 template <typename K, typename V, typename H, typename E>
 inline int unified_compare(const std::unordered_map<K, V, H, E> &a,
                            const std::unordered_map<K, V, H, E> &b)
@@ -264,6 +289,13 @@ inline int unified_compare(const std::unordered_map<K, V, H, E> &a,
     return unordered_compare(a, b);
 }
 
+template <typename K, typename V, typename H, typename E>
+inline int unified_compare(const FlatHashMap<K, V, H, E> &a,
+                           const FlatHashMap<K, V, H, E> &b)
+{
+    return unordered_compare(a, b);
+}
+
 template <class T>
 inline int ordered_compare(const T &A, const T &B)
 {
@@ -315,6 +347,8 @@ std::ostream &operator<<(std::ostream &out, const SymEngine::umap_basic_num &d);
 std::ostream &operator<<(std::ostream &out, const SymEngine::map_basic_num &d);
 std::ostream &operator<<(std::ostream &out,
                          const SymEngine::map_basic_basic &d);
+std::ostream &operator<<(std::ostream &out,
+                         const SymEngine::fmap_basic_basic &d);
 std::ostream &operator<<(std::ostream &out,
                          const SymEngine::umap_basic_basic &d);
 std::ostream &operator<<(std::ostream &out, const SymEngine::vec_basic &d);
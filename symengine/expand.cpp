@@ -1,5 +1,12 @@
 #include <symengine/visitor.h>
 
+#include <algorithm>
+#include <climits>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace SymEngine
 {
 
@@ -19,6 +26,443 @@ inline void _imulnum(const Ptr<RCP<const Number>> &self,
     *self = _mulnum(*self, other);
 }
 
+namespace
+{
+
+// Products of sums with fewer pairs of terms than this, or with fewer than
+// `expand_poly_min_ratio` pairs per term of the result, are expanded term by
+// term on `Basic`
+const double expand_poly_min_pairs = 1024;
+const double expand_poly_min_ratio = 2;
+
+// Products with fewer pairs of terms than this are not split among threads
+const double expand_parallel_min_pairs = 1 << 14;
+
+// The number of threads to use for `num_threads` (0 for the OpenMP default)
+unsigned expand_threads(unsigned num_threads)
+{
+#ifdef _OPENMP
+    return num_threads == 0 ? static_cast<unsigned>(omp_get_max_threads())
+                            : num_threads;
+#else
+    return 1;
+#endif
+}
+
+// `a*b` computed by `parts` threads, each of which multiplies a slice of the
+// terms of `a` by `b`. The partial products are added in the order of the
+// slices.
+MIntDict mul_parallel(const MIntDict &a, const MIntDict &b, unsigned parts)
+{
+    std::vector<MIntDict> slices(parts, MIntDict(a.vec_size));
+    unsigned k = 0;
+    for (const auto &t : a.dict_)
+        slices[k++ % parts].dict_.insert(t);
+#pragma omp parallel for schedule(static, 1) num_threads(parts)
+    for (unsigned p = 0; p < parts; p++) {
+        MIntDict s = MIntDict::mul(slices[p], b);
+        slices[p].dict_.swap(s.dict_);
+    }
+
+    MIntDict r(a.vec_size);
+    r.dict_.swap(slices[0].dict_);
+    for (unsigned p = 1; p < parts; p++)
+        for (auto &t : slices[p].dict_)
+            r.dict_[t.first] += t.second;
+    for (auto it = r.dict_.begin(); it != r.dict_.end();) {
+        if (it->second == 0)
+            it = r.dict_.erase(it);
+        else
+            ++it;
+    }
+    return r;
+}
+
+// `e` is an exponent that a polynomial can be raised to by `MIntDict::pow`
+inline bool is_uint_exp(const Basic &e)
+{
+    if (not is_a<Integer>(e))
+        return false;
+    const integer_class &i = down_cast<const Integer &>(e).as_integer_class();
+    return i > 0 and i <= UINT_MAX;
+}
+
+inline bool is_rational_number(const Basic &b)
+{
+    return is_a<Integer>(b) or is_a<Rational>(b);
+}
+
+double expanded_terms(const Basic &b);
+
+// An upper bound for the number of terms of `b**e` expanded, where `b` has
+// `t` terms
+double expanded_pow_terms(const Basic &b, const Basic &e)
+{
+    double t = expanded_terms(b);
+    if (t == 1 or not is_uint_exp(e))
+        return t;
+    // The number of monomials of degree `k` in `t` variables
+    double k = static_cast<double>(down_cast<const Integer &>(e).as_uint());
+    double r = 1;
+    for (double i = 1; i < t and r < 1e18; i++)
+        r = r * (k + i) / i;
+    return r;
+}
+
+// An upper bound for the number of terms of `b` expanded
+double expanded_terms(const Basic &b)
+{
+    if (is_a<Add>(b)) {
+        const Add &a = down_cast<const Add &>(b);
+        double n = a.get_coef()->is_zero() ? 0 : 1;
+        for (const auto &p : a.get_dict())
+            n += expanded_terms(*p.first);
+        return n;
+    } else if (is_a<Mul>(b)) {
+        double n = 1;
+        for (const auto &p : down_cast<const Mul &>(b).get_dict())
+            n *= expanded_pow_terms(*p.first, *p.second);
+        return n;
+    } else if (is_a<Pow>(b)) {
+        const Pow &p = down_cast<const Pow &>(b);
+        return expanded_pow_terms(*p.get_base(), *p.get_exp());
+    }
+    return 1;
+}
+
+/*! Converts polynomials with rational coefficients to `MIntDict`
+
+    The generators are the symbols and their rational powers other than the
+    positive integers (like `1/x` or `sqrt(x)`), and the rational powers of
+    integers (like `sqrt(3)`). They are treated as independent variables, so
+    relations between them (like `sqrt(3)**2 = 3`) only apply when the terms
+    are converted back. A polynomial with rational coefficients is kept as
+    `p/den`, with integer coefficients in `p`.
+*/
+class PolyConverter
+{
+public:
+    vec_basic gens;
+
+    //! Large products are split among `num_threads` threads
+    PolyConverter(unsigned num_threads = 1) : num_threads_(num_threads) {}
+
+    //! Adds the generators of `b`. \return false if `b` is not a polynomial
+    bool collect(const Basic &b)
+    {
+        if (is_rational_number(b)) {
+            return true;
+        } else if (is_a<Symbol>(b)) {
+            add_gen(b.rcp_from_this());
+            return true;
+        } else if (is_a<Add>(b)) {
+            const Add &a = down_cast<const Add &>(b);
+            if (not is_rational_number(*a.get_coef()))
+                return false;
+            for (const auto &p : a.get_dict())
+                if (not is_rational_number(*p.second) or not collect(*p.first))
+                    return false;
+            return true;
+        } else if (is_a<Mul>(b)) {
+            const Mul &m = down_cast<const Mul &>(b);
+            if (not is_rational_number(*m.get_coef()))
+                return false;
+            for (const auto &p : m.get_dict())
+                if (not collect_pow(p.first, p.second))
+                    return false;
+            return true;
+        } else if (is_a<Pow>(b)) {
+            const Pow &p = down_cast<const Pow &>(b);
+            return collect_pow(p.get_base(), p.get_exp());
+        }
+        return false;
+    }
+
+    //! Sets `r/den` to `b`, whose generators have been collected
+    void convert(const Basic &b, MIntDict &r, integer_class &den)
+    {
+        reset(r);
+        den = 1;
+        if (is_a<Integer>(b)) {
+            add_term(r, vec_uint(size(), 0),
+                     down_cast<const Integer &>(b).as_integer_class());
+        } else if (is_a<Rational>(b)) {
+            const rational_class &q
+                = down_cast<const Rational &>(b).as_rational_class();
+            add_term(r, vec_uint(size(), 0), get_num(q));
+            den = get_den(q);
+        } else if (is_a<Add>(b)) {
+            convert_add(down_cast<const Add &>(b), r, den);
+        } else if (is_a<Mul>(b)) {
+            const Mul &m = down_cast<const Mul &>(b);
+            convert(*m.get_coef(), r, den);
+            // The factors that are powers of generators are collected in
+            // one monomial
+            vec_uint e(size(), 0);
+            MIntDict f;
+            integer_class fden;
+            for (const auto &p : m.get_dict()) {
+                if (is_a<Symbol>(*p.first) and is_uint_exp(*p.second)) {
+                    e[index(p.first)] += pow_exp(*p.second);
+                } else if (not is_uint_exp(*p.second)) {
+                    e[index(pow(p.first, p.second))]++;
+                } else {
+                    convert_pow(*p.first, *p.second, f, fden);
+                    MIntDict s = mul(r, f);
+                    r.dict_.swap(s.dict_);
+                    den *= fden;
+                }
+            }
+            mul_monomial(r, e);
+        } else if (is_a<Pow>(b)) {
+            const Pow &p = down_cast<const Pow &>(b);
+            convert_pow(*p.get_base(), *p.get_exp(), r, den);
+        } else {
+            vec_uint e(size(), 0);
+            e[index(b.rcp_from_this())] = 1;
+            add_term(r, e, integer_class(1));
+        }
+    }
+
+    /*! \return an estimate for the number of terms of `b` expanded, from
+        bounds for its degrees in the generators. The powers of integers
+        (like `sqrt(3)`) are left out, as they mostly end up in the
+        coefficients.
+    */
+    double terms_estimate(const Basic &b) const
+    {
+        std::vector<double> deg(size(), 0);
+        double total = degrees(b, deg), per_gen = 1, vars = 0;
+        for (unsigned i = 0; i < size(); i++) {
+            if (not is_integer_pow(*gens[i])) {
+                per_gen *= deg[i] + 1;
+                vars++;
+            }
+        }
+        // The number of monomials of degree at most `total` in `vars`
+        // variables
+        double r = 1;
+        for (double i = 1; i <= vars and r < per_gen; i++)
+            r = r * (total + i) / i;
+        return std::min(r, per_gen);
+    }
+
+private:
+    umap_basic_uint index_;
+    unsigned num_threads_;
+
+    MIntDict mul(const MIntDict &a, const MIntDict &b) const
+    {
+        if (num_threads_ > 1
+            and static_cast<double>(a.dict_.size())
+                        * static_cast<double>(b.dict_.size())
+                    >= expand_parallel_min_pairs)
+            return mul_parallel(a, b, num_threads_);
+        return MIntDict::mul(a, b);
+    }
+
+    static bool is_integer_pow(const Basic &g)
+    {
+        return is_a<Pow>(g)
+               and is_a<Integer>(*down_cast<const Pow &>(g).get_base());
+    }
+
+    // Adds to `deg` upper bounds for the degrees of `b` in each generator.
+    // \return an upper bound for its total degree in the generators other
+    // than powers of integers
+    double degrees(const Basic &b, std::vector<double> &deg) const
+    {
+        if (is_a<Symbol>(b)) {
+            deg[index(b.rcp_from_this())] += 1;
+            return 1;
+        } else if (is_a<Add>(b)) {
+            std::vector<double> max(size(), 0), t(size());
+            double total = 0;
+            for (const auto &p : down_cast<const Add &>(b).get_dict()) {
+                std::fill(t.begin(), t.end(), 0);
+                total = std::max(total, degrees(*p.first, t));
+                for (unsigned i = 0; i < size(); i++)
+                    max[i] = std::max(max[i], t[i]);
+            }
+            for (unsigned i = 0; i < size(); i++)
+                deg[i] += max[i];
+            return total;
+        } else if (is_a<Mul>(b)) {
+            double total = 0;
+            for (const auto &p : down_cast<const Mul &>(b).get_dict())
+                total += degrees_pow(p.first, p.second, deg);
+            return total;
+        } else if (is_a<Pow>(b)) {
+            const Pow &p = down_cast<const Pow &>(b);
+            return degrees_pow(p.get_base(), p.get_exp(), deg);
+        }
+        return 0;
+    }
+
+    double degrees_pow(const RCP<const Basic> &base,
+                       const RCP<const Basic> &exp,
+                       std::vector<double> &deg) const
+    {
+        if (not is_uint_exp(*exp)) {
+            RCP<const Basic> g = pow(base, exp);
+            deg[index(g)] += 1;
+            return is_integer_pow(*g) ? 0 : 1;
+        }
+        std::vector<double> t(size(), 0);
+        double n = pow_exp(*exp), total = n * degrees(*base, t);
+        for (unsigned i = 0; i < size(); i++)
+            deg[i] += n * t[i];
+        return total;
+    }
+
+    unsigned size() const
+    {
+        return static_cast<unsigned>(gens.size());
+    }
+
+    void add_gen(const RCP<const Basic> &g)
+    {
+        if (index_.find(g) == index_.end()) {
+            index_[g] = size();
+            gens.push_back(g);
+        }
+    }
+
+    unsigned index(const RCP<const Basic> &g) const
+    {
+        return index_.find(g)->second;
+    }
+
+    static unsigned pow_exp(const Basic &e)
+    {
+        return static_cast<unsigned>(down_cast<const Integer &>(e).as_uint());
+    }
+
+    bool collect_pow(const RCP<const Basic> &base, const RCP<const Basic> &exp)
+    {
+        if (is_uint_exp(*exp))
+            return collect(*base);
+        // Symbolic exponents are left to the term by term expansion, whose
+        // results (like `x**(3 + 2*(1 + y))`) depend on the order of the
+        // products
+        if ((is_a<Symbol>(*base) or is_a<Integer>(*base))
+            and is_rational_number(*exp)) {
+            add_gen(pow(base, exp));
+            return true;
+        }
+        return false;
+    }
+
+    void reset(MIntDict &r) const
+    {
+        r.dict_.clear();
+        r.vec_size = size();
+    }
+
+    static void add_term(MIntDict &r, const vec_uint &e,
+                         const integer_class &c)
+    {
+        if (c != 0)
+            r.dict_[e] += c;
+    }
+
+    // Multiplies `r` by the monomial with exponents `e`
+    static void mul_monomial(MIntDict &r, const vec_uint &e)
+    {
+        bool constant = true;
+        for (unsigned k : e)
+            constant = constant and k == 0;
+        if (constant)
+            return;
+        umap_uvec_mpz d;
+        d.reserve(r.dict_.size());
+        for (auto &t : r.dict_) {
+            vec_uint f = t.first;
+            for (size_t i = 0; i < e.size(); i++)
+                f[i] += e[i];
+            d.insert({std::move(f), std::move(t.second)});
+        }
+        r.dict_.swap(d);
+    }
+
+    void convert_pow(const Basic &base, const Basic &exp, MIntDict &r,
+                     integer_class &den)
+    {
+        reset(r);
+        den = 1;
+        vec_uint e(size(), 0);
+        if (not is_uint_exp(exp)) {
+            e[index(pow(base.rcp_from_this(), exp.rcp_from_this()))] = 1;
+            add_term(r, e, integer_class(1));
+            return;
+        }
+        unsigned n = pow_exp(exp);
+        if (is_a<Symbol>(base)) {
+            e[index(base.rcp_from_this())] = n;
+            add_term(r, e, integer_class(1));
+            return;
+        }
+        convert(base, r, den);
+        if (n > 1) {
+            MIntDict s = MIntDict::pow(r, n);
+            r.dict_.swap(s.dict_);
+            mp_pow_ui(den, den, n);
+        }
+    }
+
+    // Appends `c*t` to `terms`
+    void convert_term(const Basic &t, const Number &c,
+                      std::vector<std::pair<MIntDict, integer_class>> &terms)
+    {
+        terms.emplace_back(MIntDict(size()), integer_class(1));
+        MIntDict &p = terms.back().first;
+        integer_class &den = terms.back().second;
+        convert(t, p, den);
+        if (is_a<Integer>(c)) {
+            const integer_class &i
+                = down_cast<const Integer &>(c).as_integer_class();
+            for (auto &q : p.dict_)
+                q.second *= i;
+        } else {
+            const rational_class &q
+                = down_cast<const Rational &>(c).as_rational_class();
+            for (auto &s : p.dict_)
+                s.second *= get_num(q);
+            den *= get_den(q);
+        }
+    }
+
+    void convert_add(const Add &a, MIntDict &r, integer_class &den)
+    {
+        // The terms are converted first, to find their common denominator
+        std::vector<std::pair<MIntDict, integer_class>> terms;
+        terms.reserve(a.get_dict().size() + 1);
+        if (not a.get_coef()->is_zero())
+            convert_term(*one, *a.get_coef(), terms);
+        for (const auto &p : a.get_dict())
+            convert_term(*p.first, *p.second, terms);
+        den = 1;
+        for (const auto &t : terms)
+            mp_lcm(den, den, t.second);
+
+        reset(r);
+        integer_class m;
+        for (auto &t : terms) {
+            mp_divexact(m, den, t.second);
+            for (auto &p : t.first.dict_)
+                mp_addmul(r.dict_[p.first], p.second, m);
+        }
+        for (auto it = r.dict_.begin(); it != r.dict_.end();) {
+            if (it->second == 0)
+                it = r.dict_.erase(it);
+            else
+                ++it;
+        }
+    }
+};
+
+} // namespace
+
 class ExpandVisitor : public BaseVisitor<ExpandVisitor>
 {
 private:
@@ -26,9 +470,13 @@ private:
     RCP<const Number> coeff = zero;
     RCP<const Number> multiply = one;
     bool deep;
+    unsigned num_threads;
 
 public:
-    ExpandVisitor(bool deep_ = true) : deep(deep_) {}
+    ExpandVisitor(bool deep_ = true, unsigned num_threads_ = 1)
+        : deep(deep_), num_threads(expand_threads(num_threads_))
+    {
+    }
     RCP<const Basic> apply(const Basic &b)
     {
         b.accept(*this);
@@ -63,6 +511,8 @@ public:
 
     void bvisit(const Mul &self)
     {
+        if (deep and mul_expand_poly(self))
+            return;
         for (auto &p : self.get_dict()) {
             if (!is_a<Symbol>(*p.first)) {
                 RCP<const Basic> a, b;
@@ -84,47 +534,28 @@ public:
                     _mulnum(multiply,
                             _mulnum(down_cast<const Add &>(*a).get_coef(),
                                     down_cast<const Add &>(*b).get_coef())));
-// Improves (x+1)**3*(x+2)**3*...(x+350)**3 expansion from 0.97s to 0.93s:
-#if defined(HAVE_SYMENGINE_RESERVE)
-            d_.reserve(d_.size()
-                       + (down_cast<const Add &>(*a)).get_dict().size()
-                             * (down_cast<const Add &>(*b)).get_dict().size());
-#endif
-            // Expand dicts first:
-            for (auto &p : (down_cast<const Add &>(*a)).get_dict()) {
-                RCP<const Number> temp = _mulnum(p.second, multiply);
-                for (auto &q : (down_cast<const Add &>(*b)).get_dict()) {
-                    // The main bottleneck here is the mul(p.first, q.first)
-                    // command
-                    RCP<const Basic> term = mul(p.first, q.first);
-                    if (is_a_Number(*term)) {
-                        iaddnum(outArg(coeff),
-                                _mulnum(_mulnum(temp, q.second),
-                                        rcp_static_cast<const Number>(term)));
-                    } else {
-                        if (is_a<Mul>(*term)
-                            && !(down_cast<const Mul &>(*term)
-                                     .get_coef()
-                                     ->is_one())) {
-                            // Tidy up things like {2x: 3} -> {x: 6}
-                            RCP<const Number> coef2
-                                = down_cast<const Mul &>(*term).get_coef();
-                            // We make a copy of the dict_:
-                            map_basic_basic d2
-                                = down_cast<const Mul &>(*term).get_dict();
-                            term = Mul::from_dict(one, std::move(d2));
-                            Add::dict_add_term(
-                                d_, _mulnum(_mulnum(temp, q.second), coef2),
-                                term);
-                        } else {
-                            Add::dict_add_term(d_, _mulnum(temp, q.second),
-                                               term);
-                        }
+            // The number of products is only an upper bound for the number
+            // of terms, which is usually much smaller (e.g. 6272 terms from
+            // 816*817 products in `expand2`), so `d_` is not reserved here
+            // but grows as needed.
+            const Add &aa = down_cast<const Add &>(*a);
+            const Add &ab = down_cast<const Add &>(*b);
+            double pairs = static_cast<double>(aa.get_dict().size())
+                           * static_cast<double>(ab.get_dict().size());
+            if (num_threads > 1 and pairs >= expand_parallel_min_pairs) {
+                mul_expand_add_parallel(aa, ab);
+            } else {
+                // Expand dicts first:
+                for (auto &p : aa.get_dict()) {
+                    RCP<const Number> temp = _mulnum(p.second, multiply);
+                    for (auto &q : ab.get_dict()) {
+                        add_term_product(d_, outArg(coeff),
+                                         _mulnum(temp, q.second), p.first,
+                                         q.first);
                     }
+                    Add::dict_add_term(d_, _mulnum(ab.get_coef(), temp),
+                                       p.first);
                 }
-                Add::dict_add_term(
-                    d_, _mulnum(down_cast<const Add &>(*b).get_coef(), temp),
-                    p.first);
             }
             // Handle the coefficient of "a":
             RCP<const Number> temp
@@ -142,10 +573,8 @@ public:
             Add::as_coef_term(a, outArg(a_coef), outArg(a_term));
             _imulnum(outArg(a_coef), multiply);
 
-#if defined(HAVE_SYMENGINE_RESERVE)
             d_.reserve(d_.size()
                        + (down_cast<const Add &>(*b)).get_dict().size());
-#endif
             for (auto &q : (down_cast<const Add &>(*b)).get_dict()) {
                 RCP<const Basic> term = mul(a_term, q.first);
                 if (is_a_Number(*term)) {
@@ -161,7 +590,7 @@ public:
                         RCP<const Number> coef2
                             = down_cast<const Mul &>(*term).get_coef();
                         // We make a copy of the dict_:
-                        map_basic_basic d2
+                        fmap_basic_basic d2
                             = down_cast<const Mul &>(*term).get_dict();
                         term = Mul::from_dict(one, std::move(d2));
                         Add::dict_add_term(
@@ -189,9 +618,7 @@ public:
     void square_expand(umap_basic_num &base_dict)
     {
         auto m = base_dict.size();
-#if defined(HAVE_SYMENGINE_RESERVE)
         d_.reserve(d_.size() + m * (m + 1) / 2);
-#endif
         RCP<const Basic> t;
         RCP<const Number> coef, two = integer(2);
         for (auto p = base_dict.begin(); p != base_dict.end(); ++p) {
@@ -217,15 +644,16 @@ public:
         multinomial_coefficients_mpz(m, n, r);
 // This speeds up overall expansion. For example for the benchmark
 // (y + x + z + w)**60 it improves the timing from 135ms to 124ms.
-#if defined(HAVE_SYMENGINE_RESERVE)
         d_.reserve(d_.size() + 2 * r.size());
-#endif
+        // The powers of the bases are computed once each
+        std::vector<std::vector<RCP<const Basic>>> powers(m);
         for (auto &p : r) {
             auto power = p.first.begin();
             auto i2 = base_dict.begin();
-            map_basic_basic d;
+            auto i3 = powers.begin();
+            fmap_basic_basic d;
             RCP<const Number> overall_coeff = one;
-            for (; power != p.first.end(); ++power, ++i2) {
+            for (; power != p.first.end(); ++power, ++i2, ++i3) {
                 if (*power > 0) {
                     RCP<const Integer> exp = integer(std::move(*power));
                     RCP<const Basic> base = i2->first;
@@ -234,27 +662,9 @@ public:
                                  rcp_static_cast<const Number>(
                                      down_cast<const Integer &>(*base).powint(
                                          *exp)));
-                    } else if (is_a<Symbol>(*base)) {
-                        Mul::dict_add_term(d, exp, base);
                     } else {
-                        RCP<const Basic> exp2, t, tmp;
-                        tmp = pow(base, exp);
-                        if (is_a<Mul>(*tmp)) {
-                            for (auto &p :
-                                 (down_cast<const Mul &>(*tmp)).get_dict()) {
-                                Mul::dict_add_term_new(outArg(overall_coeff), d,
-                                                       p.second, p.first);
-                            }
-                            _imulnum(outArg(overall_coeff),
-                                     (down_cast<const Mul &>(*tmp)).get_coef());
-                        } else if (is_a_Number(*tmp)) {
-                            _imulnum(outArg(overall_coeff),
-                                     rcp_static_cast<const Number>(tmp));
-                        } else {
-                            Mul::as_base_exp(tmp, outArg(exp2), outArg(t));
-                            Mul::dict_add_term_new(outArg(overall_coeff), d,
-                                                   exp2, t);
-                        }
+                        dict_mul_pow(outArg(overall_coeff), d, base, *power,
+                                     *i3);
                     }
                     if (!(i2->second->is_one())) {
                         _imulnum(outArg(overall_coeff),
@@ -263,27 +673,52 @@ public:
                     }
                 }
             }
-            RCP<const Basic> term = Mul::from_dict(overall_coeff, std::move(d));
-            RCP<const Number> coef2 = integer(p.second);
-            if (is_a_Number(*term)) {
-                iaddnum(outArg(coeff),
-                        _mulnum(_mulnum(multiply,
-                                        rcp_static_cast<const Number>(term)),
-                                coef2));
-            } else {
-                if (is_a<Mul>(*term)
-                    && !(down_cast<const Mul &>(*term).get_coef()->is_one())) {
-                    // Tidy up things like {2x: 3} -> {x: 6}
-                    _imulnum(outArg(coef2),
-                             down_cast<const Mul &>(*term).get_coef());
-                    // We make a copy of the dict_:
-                    map_basic_basic d2
-                        = down_cast<const Mul &>(*term).get_dict();
-                    term = Mul::from_dict(one, std::move(d2));
-                }
-                Add::dict_add_term(d_, _mulnum(multiply, coef2), term);
+            add_monomial(overall_coeff, std::move(d), integer(p.second));
+        }
+    }
+
+    //! Expands the product `self` in `MIntDict` form, if it is a polynomial
+    //! with at least two sums among its factors and enough pairs of terms
+    //! to be worth the conversions. \return false otherwise
+    bool mul_expand_poly(const Mul &self)
+    {
+        double pairs = 1;
+        unsigned sums = 0;
+        for (const auto &p : self.get_dict()) {
+            double n = expanded_pow_terms(*p.first, *p.second);
+            if (n > 1) {
+                sums++;
+                pairs *= n;
+            }
+        }
+        if (sums < 2 or pairs < expand_poly_min_pairs)
+            return false;
+        PolyConverter c(num_threads);
+        if (not c.collect(self)
+            or pairs < expand_poly_min_ratio * c.terms_estimate(self))
+            return false;
+        MIntDict r;
+        integer_class den;
+        c.convert(self, r, den);
+
+        std::vector<std::vector<RCP<const Basic>>> powers(c.gens.size());
+        d_.reserve(d_.size() + r.dict_.size());
+        for (const auto &t : r.dict_) {
+            fmap_basic_basic d;
+            RCP<const Number> overall_coeff = one;
+            for (unsigned i = 0; i < t.first.size(); i++) {
+                if (t.first[i] > 0)
+                    dict_mul_pow(outArg(overall_coeff), d, c.gens[i],
+                                 t.first[i], powers[i]);
             }
+            RCP<const Number> coef2;
+            if (den == 1)
+                coef2 = integer(t.second);
+            else
+                coef2 = Rational::from_mpq(rational_class(t.second, den));
+            add_monomial(overall_coeff, std::move(d), coef2);
         }
+        return true;
     }
 
     void bvisit(const Pow &self)
@@ -355,10 +790,124 @@ public:
     }
 
 private:
+    //! Multiplies the monomial `coef*d` by `base**k`. The powers of `base`
+    //! are cached in `powers`, or just the exponents if it is a symbol.
+    static void dict_mul_pow(const Ptr<RCP<const Number>> &coef,
+                             fmap_basic_basic &d, const RCP<const Basic> &base,
+                             unsigned k, std::vector<RCP<const Basic>> &powers)
+    {
+        if (powers.size() <= k)
+            powers.resize(k + 1);
+        if (is_a<Symbol>(*base)) {
+            if (powers[k].is_null())
+                powers[k] = integer(k);
+            Mul::dict_add_term(d, powers[k], base);
+            return;
+        }
+        if (powers[k].is_null())
+            powers[k] = pow(base, integer(k));
+        const RCP<const Basic> &tmp = powers[k];
+        if (is_a<Mul>(*tmp)) {
+            for (auto &p : (down_cast<const Mul &>(*tmp)).get_dict()) {
+                Mul::dict_add_term_new(coef, d, p.second, p.first);
+            }
+            _imulnum(coef, (down_cast<const Mul &>(*tmp)).get_coef());
+        } else if (is_a_Number(*tmp)) {
+            _imulnum(coef, rcp_static_cast<const Number>(tmp));
+        } else {
+            RCP<const Basic> exp2, t;
+            Mul::as_base_exp(tmp, outArg(exp2), outArg(t));
+            Mul::dict_add_term_new(coef, d, exp2, t);
+        }
+    }
+
+    //! Adds `c*a*b` to `d` and `coef`, for terms `a` and `b` of sums
+    static void add_term_product(umap_basic_num &d,
+                                 const Ptr<RCP<const Number>> &coef,
+                                 const RCP<const Number> &c,
+                                 const RCP<const Basic> &a,
+                                 const RCP<const Basic> &b)
+    {
+        // The main bottleneck here is the mul(a, b) command
+        RCP<const Basic> term = mul(a, b);
+        if (is_a_Number(*term)) {
+            iaddnum(coef, _mulnum(c, rcp_static_cast<const Number>(term)));
+        } else if (is_a<Mul>(*term)
+                   && !(down_cast<const Mul &>(*term).get_coef()->is_one())) {
+            // Tidy up things like {2x: 3} -> {x: 6}
+            RCP<const Number> coef2 = down_cast<const Mul &>(*term).get_coef();
+            // We make a copy of the dict_:
+            fmap_basic_basic d2 = down_cast<const Mul &>(*term).get_dict();
+            term = Mul::from_dict(one, std::move(d2));
+            Add::dict_add_term(d, _mulnum(c, coef2), term);
+        } else {
+            Add::dict_add_term(d, c, term);
+        }
+    }
+
+    //! The term loop of `mul_expand_two` for `a*b`, with the terms of `a`
+    //! split in contiguous slices among the threads. Every thread adds up
+    //! its products in its own dictionary, and these are added to `d_` in
+    //! the order of the slices, so the result does not depend on the
+    //! scheduling.
+    void mul_expand_add_parallel(const Add &a, const Add &b)
+    {
+        std::vector<const umap_basic_num::value_type *> terms;
+        terms.reserve(a.get_dict().size());
+        for (auto &p : a.get_dict())
+            terms.push_back(&p);
+        size_t n = terms.size();
+        unsigned parts = num_threads;
+        std::vector<umap_basic_num> ds(parts);
+        std::vector<RCP<const Number>> coeffs(parts, zero);
+#pragma omp parallel for schedule(static, 1) num_threads(parts)
+        for (unsigned k = 0; k < parts; k++) {
+            for (size_t i = k * n / parts; i < (k + 1) * n / parts; i++) {
+                RCP<const Number> temp = _mulnum(terms[i]->second, multiply);
+                for (auto &q : b.get_dict()) {
+                    add_term_product(ds[k], outArg(coeffs[k]),
+                                     _mulnum(temp, q.second), terms[i]->first,
+                                     q.first);
+                }
+                Add::dict_add_term(ds[k], _mulnum(b.get_coef(), temp),
+                                   terms[i]->first);
+            }
+        }
+        for (unsigned k = 0; k < parts; k++) {
+            iaddnum(outArg(coeff), coeffs[k]);
+            for (auto &t : ds[k])
+                Add::dict_add_term(d_, t.second, t.first);
+        }
+    }
+
+    //! Adds the term `coef*overall_coeff*d` times `multiply`
+    void add_monomial(const RCP<const Number> &overall_coeff,
+                      fmap_basic_basic &&d, RCP<const Number> coef)
+    {
+        RCP<const Basic> term = Mul::from_dict(overall_coeff, std::move(d));
+        if (is_a_Number(*term)) {
+            iaddnum(outArg(coeff),
+                    _mulnum(_mulnum(multiply,
+                                    rcp_static_cast<const Number>(term)),
+                            coef));
+        } else {
+            if (is_a<Mul>(*term)
+                && !(down_cast<const Mul &>(*term).get_coef()->is_one())) {
+                // Tidy up things like {2x: 3} -> {x: 6}
+                _imulnum(outArg(coef),
+                         down_cast<const Mul &>(*term).get_coef());
+                // We make a copy of the dict_:
+                fmap_basic_basic d2 = down_cast<const Mul &>(*term).get_dict();
+                term = Mul::from_dict(one, std::move(d2));
+            }
+            Add::dict_add_term(d_, _mulnum(multiply, coef), term);
+        }
+    }
+
     RCP<const Basic> expand_if_deep(const RCP<const Basic> &expr)
     {
         if (deep) {
-            return expand(expr);
+            return expand(expr, true, num_threads);
         } else {
             return expr;
         }
@@ -366,9 +915,10 @@ private:
 };
 
 //! Expands `self`
-RCP<const Basic> expand(const RCP<const Basic> &self, bool deep)
+RCP<const Basic> expand(const RCP<const Basic> &self, bool deep,
+                        unsigned num_threads)
 {
-    ExpandVisitor v(deep);
+    ExpandVisitor v(deep, num_threads);
     return v.apply(*self);
 }
 
@@ -0,0 +1,632 @@
+/**
+ *  \file flat_hash_map.h
+ *  Open addressing hash map
+ *
+ *  `FlatHashMap` is a drop-in replacement for `std::unordered_map` for the
+ *  term dictionaries (`umap_basic_num`, `umap_vec_mpz`). All the elements are
+ *  stored in a single array of slots, so inserting a term does not allocate
+ *  a node and iterating over the dictionary walks contiguous memory. Every
+ *  slot caches the hash of its key, so the (potentially expensive) key
+ *  comparison is only done when the hashes match, and growing the table
+ *  never recomputes a hash.
+ *
+ *  Collisions are resolved by linear probing, erased elements leave a
+ *  tombstone behind. The capacity is always a power of two.
+ *
+ *  Unlike `std::unordered_map`, inserting an element invalidates all the
+ *  iterators, pointers and references into the map when the table grows.
+ *  Erasing an element only invalidates the iterators, pointers and
+ *  references to that element.
+ **/
+
+#ifndef SYMENGINE_FLAT_HASH_MAP_H
+#define SYMENGINE_FLAT_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <symengine/symengine_config.h>
+
+namespace SymEngine
+{
+
+template <typename K, typename V, typename Hash = std::hash<K>,
+          typename KeyEq = std::equal_to<K>>
+class FlatHashMap
+{
+public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef std::pair<const K, V> value_type;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef Hash hasher;
+    typedef KeyEq key_equal;
+    typedef value_type &reference;
+    typedef const value_type &const_reference;
+    typedef value_type *pointer;
+    typedef const value_type *const_pointer;
+
+private:
+    // Stored hashes are never 0 or 1, these mark empty slots and tombstones
+    static const std::uint64_t empty_slot = 0;
+    static const std::uint64_t erased_slot = 1;
+
+    struct Slot {
+        std::uint64_t hash;
+        alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+        inline bool is_occupied() const
+        {
+            return hash > erased_slot;
+        }
+        inline value_type &value()
+        {
+            return *reinterpret_cast<value_type *>(storage);
+        }
+        inline const value_type &value() const
+        {
+            return *reinterpret_cast<const value_type *>(storage);
+        }
+    };
+
+    template <bool is_const>
+    class Iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef typename FlatHashMap::value_type value_type;
+        typedef typename FlatHashMap::difference_type difference_type;
+        typedef typename std::conditional<is_const, const value_type *,
+                                          value_type *>::type pointer;
+        typedef typename std::conditional<is_const, const value_type &,
+                                          value_type &>::type reference;
+        typedef typename std::conditional<is_const, const Slot *, Slot *>::type
+            slot_pointer;
+
+        Iterator() : slot_(nullptr), end_(nullptr) {}
+        Iterator(slot_pointer slot, slot_pointer end) : slot_(slot), end_(end)
+        {
+        }
+        // An iterator converts to a const_iterator
+        template <bool c, typename = typename std::enable_if<
+                              is_const and not c>::type>
+        Iterator(const Iterator<c> &it) : slot_(it.slot_), end_(it.end_)
+        {
+        }
+
+        inline reference operator*() const
+        {
+            return slot_->value();
+        }
+        inline pointer operator->() const
+        {
+            return &slot_->value();
+        }
+        inline Iterator &operator++()
+        {
+            slot_++;
+            skip_free();
+            return *this;
+        }
+        inline Iterator operator++(int)
+        {
+            Iterator it = *this;
+            ++*this;
+            return it;
+        }
+        template <bool c>
+        inline bool operator==(const Iterator<c> &it) const
+        {
+            return slot_ == it.slot_;
+        }
+        template <bool c>
+        inline bool operator!=(const Iterator<c> &it) const
+        {
+            return slot_ != it.slot_;
+        }
+
+    private:
+        slot_pointer slot_;
+        slot_pointer end_;
+
+        inline void skip_free()
+        {
+            while (slot_ != end_ and not slot_->is_occupied())
+                slot_++;
+        }
+
+        friend class FlatHashMap;
+        template <bool c>
+        friend class Iterator;
+    };
+
+public:
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    FlatHashMap() : slots_(nullptr), capacity_(0), size_(0), erased_(0) {}
+
+    explicit FlatHashMap(size_type n, const Hash &hash = Hash(),
+                         const KeyEq &eq = KeyEq())
+        : slots_(nullptr), capacity_(0), size_(0), erased_(0), hash_(hash),
+          eq_(eq)
+    {
+        reserve(n);
+    }
+
+    template <class InputIt>
+    FlatHashMap(InputIt first, InputIt last) : FlatHashMap()
+    {
+        insert(first, last);
+    }
+
+    FlatHashMap(std::initializer_list<value_type> l) : FlatHashMap()
+    {
+        reserve(l.size());
+        insert(l.begin(), l.end());
+    }
+
+    FlatHashMap(const FlatHashMap &other)
+        : slots_(nullptr), capacity_(0), size_(0), erased_(0),
+          hash_(other.hash_), eq_(other.eq_)
+    {
+        if (other.size_ == 0)
+            return;
+        // The copy gets the same layout, there is no need to probe
+        allocate(other.capacity_);
+        for (size_type i = 0; i < capacity_; i++) {
+            const Slot &s = other.slots_[i];
+            if (s.is_occupied()) {
+                new (slots_[i].storage) value_type(s.value());
+                slots_[i].hash = s.hash;
+                size_++;
+            } else {
+                slots_[i].hash = s.hash;
+            }
+        }
+        erased_ = other.erased_;
+    }
+
+    FlatHashMap(FlatHashMap &&other) SYMENGINE_NOEXCEPT
+        : slots_(other.slots_),
+          capacity_(other.capacity_),
+          size_(other.size_),
+          erased_(other.erased_),
+          hash_(std::move(other.hash_)),
+          eq_(std::move(other.eq_))
+    {
+        other.slots_ = nullptr;
+        other.capacity_ = 0;
+        other.size_ = 0;
+        other.erased_ = 0;
+    }
+
+    ~FlatHashMap()
+    {
+        destroy();
+    }
+
+    FlatHashMap &operator=(const FlatHashMap &other)
+    {
+        if (this != &other) {
+            FlatHashMap tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    FlatHashMap &operator=(FlatHashMap &&other) SYMENGINE_NOEXCEPT
+    {
+        swap(other);
+        return *this;
+    }
+
+    FlatHashMap &operator=(std::initializer_list<value_type> l)
+    {
+        FlatHashMap tmp(l);
+        swap(tmp);
+        return *this;
+    }
+
+    void swap(FlatHashMap &other) SYMENGINE_NOEXCEPT
+    {
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(erased_, other.erased_);
+        std::swap(hash_, other.hash_);
+        std::swap(eq_, other.eq_);
+    }
+
+    inline iterator begin()
+    {
+        iterator it(slots_, slots_ + capacity_);
+        it.skip_free();
+        return it;
+    }
+    inline const_iterator begin() const
+    {
+        const_iterator it(slots_, slots_ + capacity_);
+        it.skip_free();
+        return it;
+    }
+    inline const_iterator cbegin() const
+    {
+        return begin();
+    }
+    inline iterator end()
+    {
+        return iterator(slots_ + capacity_, slots_ + capacity_);
+    }
+    inline const_iterator end() const
+    {
+        return const_iterator(slots_ + capacity_, slots_ + capacity_);
+    }
+    inline const_iterator cend() const
+    {
+        return end();
+    }
+
+    inline size_type size() const
+    {
+        return size_;
+    }
+    inline bool empty() const
+    {
+        return size_ == 0;
+    }
+    //! \return the number of slots
+    inline size_type bucket_count() const
+    {
+        return capacity_;
+    }
+    inline hasher hash_function() const
+    {
+        return hash_;
+    }
+    inline key_equal key_eq() const
+    {
+        return eq_;
+    }
+
+    iterator find(const K &k)
+    {
+        size_type i = lookup(k, hash_of(k));
+        return i == npos ? end() : iterator_at(i);
+    }
+    const_iterator find(const K &k) const
+    {
+        size_type i = lookup(k, hash_of(k));
+        return i == npos ? end()
+                         : const_iterator(slots_ + i, slots_ + capacity_);
+    }
+    size_type count(const K &k) const
+    {
+        return lookup(k, hash_of(k)) == npos ? 0 : 1;
+    }
+
+    V &at(const K &k)
+    {
+        size_type i = lookup(k, hash_of(k));
+        if (i == npos)
+            throw std::out_of_range("FlatHashMap::at: key not found");
+        return slots_[i].value().second;
+    }
+    const V &at(const K &k) const
+    {
+        size_type i = lookup(k, hash_of(k));
+        if (i == npos)
+            throw std::out_of_range("FlatHashMap::at: key not found");
+        return slots_[i].value().second;
+    }
+
+    V &operator[](const K &k)
+    {
+        return emplace_key(k).first->second;
+    }
+    V &operator[](K &&k)
+    {
+        return emplace_key(std::move(k)).first->second;
+    }
+
+    std::pair<iterator, bool> insert(const value_type &p)
+    {
+        return emplace_key(p.first, p.second);
+    }
+    // Accepts any pair convertible to `value_type`, e.g. a pair of RCPs to
+    // subclasses of the key and value types.
+    template <class P, typename = typename std::enable_if<std::is_constructible<
+                           value_type, P &&>::value>::type>
+    std::pair<iterator, bool> insert(P &&p)
+    {
+        return emplace_key(std::forward<P>(p).first,
+                           std::forward<P>(p).second);
+    }
+    iterator insert(const_iterator hint, const value_type &p)
+    {
+        return insert(p).first;
+    }
+    template <class P, typename = typename std::enable_if<std::is_constructible<
+                           value_type, P &&>::value>::type>
+    iterator insert(const_iterator hint, P &&p)
+    {
+        return insert(std::forward<P>(p)).first;
+    }
+    template <class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+    void insert(std::initializer_list<value_type> l)
+    {
+        insert(l.begin(), l.end());
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool> emplace(Args &&...args)
+    {
+        std::pair<K, V> p(std::forward<Args>(args)...);
+        return emplace_key(std::move(p.first), std::move(p.second));
+    }
+    template <class... Args>
+    iterator emplace_hint(const_iterator hint, Args &&...args)
+    {
+        return emplace(std::forward<Args>(args)...).first;
+    }
+
+    //! Erases the element at `pos`
+    //! \return the iterator following the erased element
+    iterator erase(const_iterator pos)
+    {
+        size_type i = pos.slot_ - slots_;
+        erase_slot(i);
+        iterator it = iterator_at(i);
+        it.skip_free();
+        return it;
+    }
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+    size_type erase(const K &k)
+    {
+        size_type i = lookup(k, hash_of(k));
+        if (i == npos)
+            return 0;
+        erase_slot(i);
+        return 1;
+    }
+
+    void clear()
+    {
+        for (size_type i = 0; i < capacity_; i++) {
+            if (slots_[i].is_occupied())
+                slots_[i].value().~value_type();
+            slots_[i].hash = empty_slot;
+        }
+        size_ = 0;
+        erased_ = 0;
+    }
+
+    //! Makes room for `n` elements without growing the table again
+    void reserve(size_type n)
+    {
+        size_type capacity = min_capacity;
+        while (exceeds_max_load(n, capacity))
+            capacity *= 2;
+        if (capacity > capacity_)
+            rehash_into(capacity);
+    }
+
+private:
+    static const size_type npos = size_type(-1);
+    static const size_type min_capacity = 4;
+
+    Slot *slots_;
+    size_type capacity_;
+    size_type size_;
+    // Number of tombstones
+    size_type erased_;
+    Hash hash_;
+    KeyEq eq_;
+
+    // The table grows when more than 3/4 of the slots are used (including
+    // tombstones), so that the probe sequences stay short and always end.
+    static inline bool exceeds_max_load(size_type used, size_type capacity)
+    {
+        return 4 * used > 3 * capacity;
+    }
+
+    inline std::uint64_t hash_of(const K &k) const
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(hash_(k));
+        return h > erased_slot ? h : h + 2;
+    }
+
+    // Fibonacci hashing, spreads the bits of hashes that only differ in their
+    // high bits (or are small integers) over the whole table
+    inline size_type home_slot(std::uint64_t h) const
+    {
+        return static_cast<size_type>((h * UINT64_C(0x9E3779B97F4A7C15))
+                                      >> 32)
+               & (capacity_ - 1);
+    }
+
+    inline iterator iterator_at(size_type i)
+    {
+        return iterator(slots_ + i, slots_ + capacity_);
+    }
+
+    size_type lookup(const K &k, std::uint64_t h) const
+    {
+        if (size_ == 0)
+            return npos;
+        size_type mask = capacity_ - 1;
+        for (size_type i = home_slot(h);; i = (i + 1) & mask) {
+            const Slot &s = slots_[i];
+            if (s.hash == empty_slot)
+                return npos;
+            if (s.hash == h and eq_(s.value().first, k))
+                return i;
+        }
+    }
+
+    // Finds the key `k`, or else inserts the element constructed from `k` and
+    // `args` (the arguments of the value's constructor).
+    template <class KArg, class... VArgs>
+    std::pair<iterator, bool> emplace_key(KArg &&k, VArgs &&...args)
+    {
+        const K &key = k;
+        std::uint64_t h = hash_of(key);
+        size_type i = npos;
+        if (capacity_ != 0) {
+            size_type mask = capacity_ - 1;
+            for (size_type j = home_slot(h);; j = (j + 1) & mask) {
+                const Slot &s = slots_[j];
+                if (s.hash == empty_slot) {
+                    if (i == npos)
+                        i = j;
+                    break;
+                }
+                if (s.hash == erased_slot) {
+                    // Reuse the first tombstone, but keep looking for `k`
+                    if (i == npos)
+                        i = j;
+                } else if (s.hash == h and eq_(s.value().first, key)) {
+                    return std::make_pair(iterator_at(j), false);
+                }
+            }
+        }
+        if (i == npos
+            or (slots_[i].hash == empty_slot
+                and exceeds_max_load(size_ + erased_ + 1, capacity_))) {
+            grow();
+            i = free_slot(h);
+        }
+        Slot &s = slots_[i];
+        new (s.storage) value_type(std::piecewise_construct,
+                                   std::forward_as_tuple(std::forward<KArg>(k)),
+                                   std::forward_as_tuple(
+                                       std::forward<VArgs>(args)...));
+        if (s.hash == erased_slot)
+            erased_--;
+        s.hash = h;
+        size_++;
+        return std::make_pair(iterator_at(i), true);
+    }
+
+    // \return the first free slot in the probe sequence of `h`
+    inline size_type free_slot(std::uint64_t h) const
+    {
+        size_type mask = capacity_ - 1;
+        size_type i = home_slot(h);
+        while (slots_[i].is_occupied())
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    void erase_slot(size_type i)
+    {
+        slots_[i].value().~value_type();
+        size_--;
+        // If the next slot is empty, no probe sequence continues past this
+        // one, so it can be marked empty instead of leaving a tombstone
+        if (slots_[(i + 1) & (capacity_ - 1)].hash == empty_slot) {
+            slots_[i].hash = empty_slot;
+        } else {
+            slots_[i].hash = erased_slot;
+            erased_++;
+        }
+    }
+
+    void grow()
+    {
+        size_type capacity = capacity_ == 0 ? min_capacity : capacity_;
+        // Only drop the tombstones if that frees enough space
+        while (exceeds_max_load(2 * size_, capacity))
+            capacity *= 2;
+        rehash_into(capacity);
+    }
+
+    void allocate(size_type capacity)
+    {
+        slots_ = static_cast<Slot *>(::operator new(capacity * sizeof(Slot)));
+        capacity_ = capacity;
+        for (size_type i = 0; i < capacity; i++)
+            slots_[i].hash = empty_slot;
+    }
+
+    void rehash_into(size_type capacity)
+    {
+        Slot *old = slots_;
+        size_type old_capacity = capacity_;
+        allocate(capacity);
+        erased_ = 0;
+        for (size_type i = 0; i < old_capacity; i++) {
+            Slot &s = old[i];
+            if (s.is_occupied()) {
+                Slot &t = slots_[free_slot(s.hash)];
+                // The old element is destroyed right away, so its key can be
+                // moved from
+                new (t.storage)
+                    value_type(std::move(const_cast<K &>(s.value().first)),
+                               std::move(s.value().second));
+                t.hash = s.hash;
+                s.value().~value_type();
+            }
+        }
+        ::operator delete(old);
+    }
+
+    void destroy()
+    {
+        for (size_type i = 0; i < capacity_; i++) {
+            if (slots_[i].is_occupied())
+                slots_[i].value().~value_type();
+        }
+        ::operator delete(slots_);
+        slots_ = nullptr;
+        capacity_ = 0;
+        size_ = 0;
+        erased_ = 0;
+    }
+};
+
+template <typename K, typename V, typename H, typename E>
+inline void swap(FlatHashMap<K, V, H, E> &a, FlatHashMap<K, V, H, E> &b)
+{
+    a.swap(b);
+}
+
+template <typename K, typename V, typename H, typename E>
+bool operator==(const FlatHashMap<K, V, H, E> &a,
+                const FlatHashMap<K, V, H, E> &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (const auto &p : a) {
+        auto f = b.find(p.first);
+        if (f == b.end() or not(f->second == p.second))
+            return false;
+    }
+    return true;
+}
+
+template <typename K, typename V, typename H, typename E>
+inline bool operator!=(const FlatHashMap<K, V, H, E> &a,
+                       const FlatHashMap<K, V, H, E> &b)
+{
+    return not(a == b);
+}
+
+} // namespace SymEngine
+
+#endif
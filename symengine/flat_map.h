@@ -0,0 +1,344 @@
+/**
+ *  \file flat_map.h
+ *  Sorted vector map
+ *
+ *  `FlatMap` keeps its elements in a `std::vector` sorted by the key. It has
+ *  the `std::map` interface and iteration order, but no per element
+ *  allocation, and iterating, copying, hashing or comparing two maps walks
+ *  contiguous memory. Lookups are binary searches, while inserting and
+ *  erasing shift the following elements. This makes it a good fit for small
+ *  dictionaries that are built once and then mostly read, like the factors
+ *  of a `Mul` (usually two to six of them).
+ *
+ *  Unlike `std::map`, inserting or erasing an element invalidates the
+ *  iterators, pointers and references to the elements after it (and to all
+ *  the elements if the vector reallocates). The elements are
+ *  `std::pair<K, V>`, the key must not be modified through an iterator.
+ **/
+
+#ifndef SYMENGINE_FLAT_MAP_H
+#define SYMENGINE_FLAT_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace SymEngine
+{
+
+//! Tag for the `FlatMap` constructor from a range that is already sorted and
+//! has no duplicate keys
+struct sorted_unique_t {
+};
+const sorted_unique_t sorted_unique = sorted_unique_t();
+
+template <typename K, typename V, typename Compare = std::less<K>>
+class FlatMap
+{
+public:
+    typedef K key_type;
+    typedef V mapped_type;
+    typedef std::pair<K, V> value_type;
+    typedef Compare key_compare;
+    typedef std::vector<value_type> container_type;
+    typedef typename container_type::size_type size_type;
+    typedef typename container_type::difference_type difference_type;
+    typedef typename container_type::iterator iterator;
+    typedef typename container_type::const_iterator const_iterator;
+    typedef typename container_type::reverse_iterator reverse_iterator;
+    typedef typename container_type::const_reverse_iterator
+        const_reverse_iterator;
+    typedef value_type &reference;
+    typedef const value_type &const_reference;
+
+    FlatMap() {}
+
+    //! Constructs the map from any range, later duplicates of a key are
+    //! ignored (as by `insert()`)
+    template <class InputIt>
+    FlatMap(InputIt first, InputIt last) : v_(first, last)
+    {
+        sort_unique();
+    }
+
+    //! Constructs the map from a range sorted by `Compare` without
+    //! duplicate keys
+    template <class InputIt>
+    FlatMap(sorted_unique_t, InputIt first, InputIt last) : v_(first, last)
+    {
+    }
+
+    FlatMap(std::initializer_list<value_type> l) : v_(l)
+    {
+        sort_unique();
+    }
+
+    FlatMap &operator=(std::initializer_list<value_type> l)
+    {
+        v_ = l;
+        sort_unique();
+        return *this;
+    }
+
+    inline iterator begin()
+    {
+        return v_.begin();
+    }
+    inline const_iterator begin() const
+    {
+        return v_.begin();
+    }
+    inline const_iterator cbegin() const
+    {
+        return v_.cbegin();
+    }
+    inline iterator end()
+    {
+        return v_.end();
+    }
+    inline const_iterator end() const
+    {
+        return v_.end();
+    }
+    inline const_iterator cend() const
+    {
+        return v_.cend();
+    }
+    inline reverse_iterator rbegin()
+    {
+        return v_.rbegin();
+    }
+    inline const_reverse_iterator rbegin() const
+    {
+        return v_.rbegin();
+    }
+    inline reverse_iterator rend()
+    {
+        return v_.rend();
+    }
+    inline const_reverse_iterator rend() const
+    {
+        return v_.rend();
+    }
+
+    inline size_type size() const
+    {
+        return v_.size();
+    }
+    inline bool empty() const
+    {
+        return v_.empty();
+    }
+    inline void reserve(size_type n)
+    {
+        v_.reserve(n);
+    }
+    inline void clear()
+    {
+        v_.clear();
+    }
+    inline key_compare key_comp() const
+    {
+        return comp_;
+    }
+    //! \return the underlying sorted vector
+    inline const container_type &elements() const
+    {
+        return v_;
+    }
+
+    iterator lower_bound(const K &k)
+    {
+        return std::lower_bound(v_.begin(), v_.end(), k, KeyLess(comp_));
+    }
+    const_iterator lower_bound(const K &k) const
+    {
+        return std::lower_bound(v_.begin(), v_.end(), k, KeyLess(comp_));
+    }
+    iterator upper_bound(const K &k)
+    {
+        iterator it = lower_bound(k);
+        return (it != v_.end() and not comp_(k, it->first)) ? it + 1 : it;
+    }
+    const_iterator upper_bound(const K &k) const
+    {
+        const_iterator it = lower_bound(k);
+        return (it != v_.end() and not comp_(k, it->first)) ? it + 1 : it;
+    }
+
+    iterator find(const K &k)
+    {
+        iterator it = lower_bound(k);
+        return (it != v_.end() and not comp_(k, it->first)) ? it : v_.end();
+    }
+    const_iterator find(const K &k) const
+    {
+        const_iterator it = lower_bound(k);
+        return (it != v_.end() and not comp_(k, it->first)) ? it : v_.end();
+    }
+    size_type count(const K &k) const
+    {
+        return find(k) == v_.end() ? 0 : 1;
+    }
+
+    V &at(const K &k)
+    {
+        iterator it = find(k);
+        if (it == v_.end())
+            throw std::out_of_range("FlatMap::at: key not found");
+        return it->second;
+    }
+    const V &at(const K &k) const
+    {
+        const_iterator it = find(k);
+        if (it == v_.end())
+            throw std::out_of_range("FlatMap::at: key not found");
+        return it->second;
+    }
+
+    V &operator[](const K &k)
+    {
+        iterator it = lower_bound(k);
+        if (it == v_.end() or comp_(k, it->first))
+            it = v_.emplace(it, k, V());
+        return it->second;
+    }
+    V &operator[](K &&k)
+    {
+        iterator it = lower_bound(k);
+        if (it == v_.end() or comp_(k, it->first))
+            it = v_.emplace(it, std::move(k), V());
+        return it->second;
+    }
+
+    // Accepts any pair convertible to `value_type`, e.g. a pair of RCPs to
+    // subclasses of the key and value types.
+    template <class P, typename = typename std::enable_if<std::is_constructible<
+                           value_type, P &&>::value>::type>
+    std::pair<iterator, bool> insert(P &&p)
+    {
+        return emplace_key(std::forward<P>(p).first, std::forward<P>(p).second);
+    }
+    std::pair<iterator, bool> insert(const value_type &p)
+    {
+        return emplace_key(p.first, p.second);
+    }
+    std::pair<iterator, bool> insert(value_type &&p)
+    {
+        return emplace_key(std::move(p.first), std::move(p.second));
+    }
+    iterator insert(const_iterator hint, const value_type &p)
+    {
+        return emplace_hint(hint, p.first, p.second);
+    }
+    template <class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+    void insert(std::initializer_list<value_type> l)
+    {
+        insert(l.begin(), l.end());
+    }
+
+    template <class... Args>
+    std::pair<iterator, bool> emplace(Args &&...args)
+    {
+        value_type p(std::forward<Args>(args)...);
+        return emplace_key(std::move(p.first), std::move(p.second));
+    }
+
+    //! Inserts the element in front of `hint` without a search if that keeps
+    //! the map sorted, so appending keys in order is linear
+    template <class KArg, class VArg>
+    iterator emplace_hint(const_iterator hint, KArg &&k, VArg &&v)
+    {
+        const K &key = k;
+        if ((hint == v_.cend() or comp_(key, hint->first))
+            and (hint == v_.cbegin() or comp_((hint - 1)->first, key))) {
+            return v_.emplace(v_.begin() + (hint - v_.cbegin()),
+                              std::forward<KArg>(k), std::forward<VArg>(v));
+        }
+        return emplace_key(std::forward<KArg>(k), std::forward<VArg>(v)).first;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return v_.erase(pos);
+    }
+    iterator erase(iterator pos)
+    {
+        return v_.erase(pos);
+    }
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return v_.erase(first, last);
+    }
+    size_type erase(const K &k)
+    {
+        iterator it = find(k);
+        if (it == v_.end())
+            return 0;
+        v_.erase(it);
+        return 1;
+    }
+
+    void swap(FlatMap &other)
+    {
+        v_.swap(other.v_);
+        std::swap(comp_, other.comp_);
+    }
+
+private:
+    container_type v_;
+    Compare comp_;
+
+    struct KeyLess {
+        const Compare &comp;
+        KeyLess(const Compare &c) : comp(c) {}
+        inline bool operator()(const value_type &p, const K &k) const
+        {
+            return comp(p.first, k);
+        }
+    };
+
+    template <class KArg, class VArg>
+    std::pair<iterator, bool> emplace_key(KArg &&k, VArg &&v)
+    {
+        const K &key = k;
+        iterator it = lower_bound(key);
+        if (it != v_.end() and not comp_(key, it->first))
+            return std::make_pair(it, false);
+        it = v_.emplace(it, std::forward<KArg>(k), std::forward<VArg>(v));
+        return std::make_pair(it, true);
+    }
+
+    void sort_unique()
+    {
+        const Compare &comp = comp_;
+        // A stable sort keeps the first of the duplicates, like insert()
+        std::stable_sort(v_.begin(), v_.end(),
+                         [&comp](const value_type &a, const value_type &b) {
+                             return comp(a.first, b.first);
+                         });
+        v_.erase(std::unique(v_.begin(), v_.end(),
+                             [&comp](const value_type &a, const value_type &b) {
+                                 return not comp(a.first, b.first);
+                             }),
+                 v_.end());
+    }
+};
+
+template <typename K, typename V, typename C>
+inline void swap(FlatMap<K, V, C> &a, FlatMap<K, V, C> &b)
+{
+    a.swap(b);
+}
+
+} // namespace SymEngine
+
+#endif
@@ -156,8 +156,8 @@ RCP<const Basic> conjugate(const RCP<const Basic> &arg)
         return arg;
     }
     if (is_a<Mul>(*arg)) {
-        const map_basic_basic &dict = down_cast<const Mul &>(*arg).get_dict();
-        map_basic_basic new_dict;
+        const fmap_basic_basic &dict = down_cast<const Mul &>(*arg).get_dict();
+        fmap_basic_basic new_dict;
         RCP<const Number> coef = rcp_static_cast<const Number>(
             conjugate(down_cast<const Mul &>(*arg).get_coef()));
         for (const auto &p : dict) {
@@ -561,7 +561,7 @@ RCP<const Basic> sign(const RCP<const Basic> &arg)
     }
     if (is_a<Mul>(*arg)) {
         RCP<const Basic> s = sign(down_cast<const Mul &>(*arg).get_coef());
-        map_basic_basic dict = down_cast<const Mul &>(*arg).get_dict();
+        fmap_basic_basic dict = down_cast<const Mul &>(*arg).get_dict();
         return mul(s,
                    make_rcp<const Sign>(Mul::from_dict(one, std::move(dict))));
     }
@@ -41,6 +41,10 @@ public:
     {
         return {arg_};
     }
+    void for_each_arg(const arg_callback &f) const override
+    {
+        f(arg_);
+    }
     //! Method to construct classes with canonicalization
     virtual RCP<const Basic> create(const RCP<const Basic> &arg) const = 0;
 
@@ -101,6 +105,11 @@ public:
     {
         return {a_, b_};
     }
+    void for_each_arg(const arg_callback &f) const override
+    {
+        f(a_);
+        f(b_);
+    }
     //! Method to construct classes with canonicalization
     virtual RCP<const Basic> create(const RCP<const Basic> &a,
                                     const RCP<const Basic> &b) const = 0;
@@ -160,6 +169,11 @@ public:
     {
         return arg_;
     }
+    void for_each_arg(const arg_callback &f) const override
+    {
+        for (const auto &a : arg_)
+            f(a);
+    }
     inline const vec_basic &get_vec() const
     {
         return arg_;
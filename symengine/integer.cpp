@@ -6,6 +6,25 @@
 namespace SymEngine
 {
 
+const RCP<const Integer> *integer_cache()
+{
+    // The table is never destroyed, so that the shared nodes outlive any
+    // expression that refers to them. It is first used when the constants
+    // are initialized (see constants.cpp), so it is never allocated inside
+    // a PoolArena.
+    static const RCP<const Integer> *cache = [] {
+        RCP<const Integer> *table
+            = new RCP<const Integer>[integer_cache_max - integer_cache_min
+                                     + 1];
+        for (long i = integer_cache_min; i <= integer_cache_max; i++) {
+            table[i - integer_cache_min]
+                = make_rcp<const Integer>(integer_class(i));
+        }
+        return table;
+    }();
+    return cache;
+}
+
 hash_t Integer::__hash__() const
 {
     // only the least significant bits that fit into "long long int" are
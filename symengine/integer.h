@@ -14,6 +14,23 @@
 namespace SymEngine
 {
 
+class Integer;
+
+//! Integers in [integer_cache_min, integer_cache_max] are preallocated, the
+//! factories below and the Integer arithmetic return the shared nodes.
+const long integer_cache_min = -1024;
+const long integer_cache_max = 1024;
+
+//! \return the table of the preallocated Integers, indexed by
+//! `i - integer_cache_min`
+const RCP<const Integer> *integer_cache();
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value,
+                               RCP<const Integer>>::type
+integer(T i);
+inline RCP<const Integer> integer(integer_class i);
+
 //! Integer Class
 class Integer : public Number
 {
@@ -79,20 +96,34 @@ public:
     }
 
     /* These are very fast methods for add/sub/mul/div/pow on Integers only */
+    // The machine word fast paths avoid the integer_class arithmetic (and
+    // its temporaries) when both operands and the result fit into a long.
     //! Fast Integer Addition
     inline RCP<const Integer> addint(const Integer &other) const
     {
-        return make_rcp<const Integer>(this->i + other.i);
+        long a, b, r;
+        if (mp_get_si_if_fits(this->i, a) and mp_get_si_if_fits(other.i, b)
+            and mp_add_si_checked(a, b, r))
+            return integer(r);
+        return integer(this->i + other.i);
     }
     //! Fast Integer Subtraction
     inline RCP<const Integer> subint(const Integer &other) const
     {
-        return make_rcp<const Integer>(this->i - other.i);
+        long a, b, r;
+        if (mp_get_si_if_fits(this->i, a) and mp_get_si_if_fits(other.i, b)
+            and mp_sub_si_checked(a, b, r))
+            return integer(r);
+        return integer(this->i - other.i);
     }
     //! Fast Integer Multiplication
     inline RCP<const Integer> mulint(const Integer &other) const
     {
-        return make_rcp<const Integer>(this->i * other.i);
+        long a, b, r;
+        if (mp_get_si_if_fits(this->i, a) and mp_get_si_if_fits(other.i, b)
+            and mp_mul_si_checked(a, b, r))
+            return integer(r);
+        return integer(this->i * other.i);
     }
     //!  Integer Division
     RCP<const Number> divint(const Integer &other) const;
@@ -108,14 +139,18 @@ public:
             else
                 return pow_negint(other);
         }
+        unsigned long n = mp_get_ui(other.i);
+        long a, r;
+        if (mp_get_si_if_fits(i, a) and mp_pow_si_checked(a, n, r))
+            return integer(r);
         integer_class tmp;
-        mp_pow_ui(tmp, i, mp_get_ui(other.i));
-        return make_rcp<const Integer>(std::move(tmp));
+        mp_pow_ui(tmp, i, n);
+        return integer(std::move(tmp));
     }
     //! \return negative of self.
     inline RCP<const Integer> neg() const
     {
-        return make_rcp<const Integer>(-i);
+        return integer(-i);
     }
 
     /* These are general methods, overriden from the Number class, that need to
@@ -190,18 +225,34 @@ struct RCPIntegerKeyLess {
         return a->as_integer_class() < b->as_integer_class();
     }
 };
+//! \return true if `i` is in the range of the preallocated Integers
+template <typename T>
+inline bool is_cached_integer(T i)
+{
+    if (std::is_signed<T>::value)
+        return static_cast<long long>(i) >= integer_cache_min
+               and static_cast<long long>(i) <= integer_cache_max;
+    return static_cast<unsigned long long>(i)
+           <= static_cast<unsigned long long>(integer_cache_max);
+}
+
 //! \return RCP<const Integer> from integral values
 template <typename T>
 inline typename std::enable_if<std::is_integral<T>::value,
                                RCP<const Integer>>::type
 integer(T i)
 {
+    if (is_cached_integer(i))
+        return integer_cache()[static_cast<long>(i) - integer_cache_min];
     return make_rcp<const Integer>(integer_class(i));
 }
 
 //! \return RCP<const Integer> from integer_class
 inline RCP<const Integer> integer(integer_class i)
 {
+    long r;
+    if (mp_get_si_if_fits(i, r) and is_cached_integer(r))
+        return integer_cache()[r - integer_cache_min];
     return make_rcp<const Integer>(std::move(i));
 }
 
@@ -0,0 +1,118 @@
+#include <symengine/intern.h>
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+#include <mutex>
+#endif
+
+namespace SymEngine
+{
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+std::atomic<bool> interning_flag(false);
+#else
+bool interning_flag = false;
+#endif
+
+namespace
+{
+
+// The table maps the (cached) hash of a node to the node itself. Several
+// non-equal nodes can have the same hash, so it is a multimap. We never call
+// virtual methods of a node while removing it, because `unintern()` runs from
+// `Basic::~Basic()` when the derived part is already destroyed: removal only
+// compares pointers.
+typedef std::unordered_multimap<hash_t, const Basic *> intern_map;
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+const unsigned intern_shards = 64;
+#else
+const unsigned intern_shards = 1;
+#endif
+
+struct InternShard {
+    intern_map map;
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+    std::mutex mutex;
+#endif
+};
+
+InternShard &get_shard(hash_t h)
+{
+    // The table is never destroyed, so that nodes that are still alive at
+    // program exit (e.g. in static variables) can safely unintern themselves.
+    static InternShard *shards = new InternShard[intern_shards];
+    return shards[h % intern_shards];
+}
+
+} // namespace
+
+void set_interning(bool enable)
+{
+    interning_flag = enable;
+}
+
+RCP<const Basic> intern_basic(const RCP<const Basic> &x)
+{
+    hash_t h = x->hash();
+    InternShard &shard = get_shard(h);
+    // References to non-matching candidates are only released after the
+    // lock is dropped, as the release can destroy the node and re-enter
+    // `unintern()`.
+    vec_basic candidates;
+    RCP<const Basic> result;
+    {
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+        std::lock_guard<std::mutex> lock(shard.mutex);
+#endif
+        auto range = shard.map.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            // Nodes whose reference count already dropped to zero are being
+            // destroyed and must not be resurrected
+            RCP<const Basic> c = it->second->rcp_from_this_if_alive();
+            if (c.is_null())
+                continue;
+            if (eq(*c, *x)) {
+                result = c;
+                break;
+            }
+            candidates.push_back(c);
+        }
+        if (result.is_null()) {
+            x->interned_ = true;
+            shard.map.insert(std::make_pair(h, x.get()));
+            result = x;
+        }
+    }
+    return result;
+}
+
+void unintern(const Basic &b)
+{
+    hash_t h = b.hash_;
+    InternShard &shard = get_shard(h);
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+    std::lock_guard<std::mutex> lock(shard.mutex);
+#endif
+    auto range = shard.map.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == &b) {
+            shard.map.erase(it);
+            return;
+        }
+    }
+}
+
+size_t interned_count()
+{
+    size_t count = 0;
+    for (unsigned i = 0; i < intern_shards; i++) {
+        InternShard &shard = get_shard(i);
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+        std::lock_guard<std::mutex> lock(shard.mutex);
+#endif
+        count += shard.map.size();
+    }
+    return count;
+}
+
+} // namespace SymEngine
@@ -0,0 +1,63 @@
+/**
+ *  \file intern.h
+ *  Optional hash-consing (interning) of Basic nodes
+ *
+ *  When interning is enabled, the canonical constructors (`symbol()`,
+ *  `pow()`, `Add::from_dict()`, `Mul::from_dict()`) look up every newly
+ *  built node in a global unique table and return the already existing,
+ *  structurally equal node if there is one. Equal expressions then share a
+ *  single node, so `eq()` succeeds on the pointer comparison and memory use
+ *  drops for expressions with many repeated subexpressions.
+ *
+ *  The table does not own the nodes: it stores raw pointers that are removed
+ *  from the table in `Basic::~Basic()`, so interned nodes are freed as usual
+ *  once the last RCP to them goes away. With `WITH_SYMENGINE_THREAD_SAFE`
+ *  the table is sharded and every shard is protected by its own mutex.
+ *
+ *  Interning is disabled by default.
+ **/
+
+#ifndef SYMENGINE_INTERN_H
+#define SYMENGINE_INTERN_H
+
+#include <symengine/basic.h>
+
+namespace SymEngine
+{
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+extern SYMENGINE_EXPORT std::atomic<bool> interning_flag;
+#else
+extern SYMENGINE_EXPORT bool interning_flag;
+#endif
+
+//! Enables or disables interning of newly constructed expressions.
+//! Nodes that were already interned stay in the table until they die.
+void set_interning(bool enable);
+
+//! \return true if the canonical constructors intern their results
+inline bool interning_enabled()
+{
+    return interning_flag;
+}
+
+//! \return the node from the unique table that is equal to `x`. If there is
+//! none, `x` itself is inserted into the table and returned.
+RCP<const Basic> intern_basic(const RCP<const Basic> &x);
+
+//! Typed version of `intern_basic()`, returns `x` unchanged when interning
+//! is disabled.
+template <class T>
+inline RCP<const T> intern(RCP<const T> x)
+{
+    if (not interning_enabled() or x->is_interned())
+        return x;
+    return rcp_static_cast<const T>(intern_basic(x));
+}
+
+//! \return the number of (live) nodes currently held by the unique table
+size_t interned_count();
+
+} // namespace SymEngine
+
+#endif
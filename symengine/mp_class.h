@@ -4,6 +4,7 @@
 #include <symengine/symengine_config.h>
 #include <symengine/symengine_casts.h>
 #include <cstring>
+#include <climits>
 #if SYMENGINE_INTEGER_CLASS != SYMENGINE_BOOSTMP
 #include <symengine/mp_wrapper.h>
 #endif
@@ -1255,6 +1256,86 @@ private:
 
 #endif // SYMENGINE_INTEGER_CLASS == Piranha or Flint or GMP or GMPXX
 
+// Fast paths for integers that fit into a machine word. Each function
+// returns false if an argument or the result does not fit into a signed
+// long; the caller then falls back to the integer_class arithmetic.
+
+//! Stores `i` into `r` if it fits into a signed long
+inline bool mp_get_si_if_fits(const integer_class &i, long &r)
+{
+#if SYMENGINE_INTEGER_CLASS == SYMENGINE_GMP
+    return i.get_si_if_fits(r);
+#else
+    if (not mp_fits_slong_p(i))
+        return false;
+    r = mp_get_si(i);
+    return true;
+#endif
+}
+
+//! `r = a + b` unless it overflows
+inline bool mp_add_si_checked(long a, long b, long &r)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return not __builtin_add_overflow(a, b, &r);
+#else
+    if ((b > 0 and a > LONG_MAX - b) or (b < 0 and a < LONG_MIN - b))
+        return false;
+    r = a + b;
+    return true;
+#endif
+}
+
+//! `r = a - b` unless it overflows
+inline bool mp_sub_si_checked(long a, long b, long &r)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return not __builtin_sub_overflow(a, b, &r);
+#else
+    if ((b < 0 and a > LONG_MAX + b) or (b > 0 and a < LONG_MIN + b))
+        return false;
+    r = a - b;
+    return true;
+#endif
+}
+
+//! `r = a * b` unless it overflows
+inline bool mp_mul_si_checked(long a, long b, long &r)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return not __builtin_mul_overflow(a, b, &r);
+#else
+    if (a > 0) {
+        if ((b > 0 and a > LONG_MAX / b) or (b < 0 and b < LONG_MIN / a))
+            return false;
+    } else if (a < 0) {
+        if ((b > 0 and a < LONG_MIN / b) or (b < 0 and a < LONG_MAX / b))
+            return false;
+    }
+    r = a * b;
+    return true;
+#endif
+}
+
+//! `r = a**n` unless it overflows
+inline bool mp_pow_si_checked(long a, unsigned long n, long &r)
+{
+    long result = 1;
+    while (true) {
+        if (n & 1u) {
+            if (not mp_mul_si_checked(result, a, result))
+                return false;
+        }
+        n >>= 1;
+        if (n == 0)
+            break;
+        if (not mp_mul_si_checked(a, a, a))
+            return false;
+    }
+    r = result;
+    return true;
+}
+
 } // namespace SymEngine
 
 #if !defined(HAVE_SYMENGINE_GMP) && defined(HAVE_SYMENGINE_BOOST)              \
@@ -3,6 +3,7 @@
 
 #include <symengine/symengine_rcp.h>
 #include <gmp.h>
+#include <climits>
 
 #define SYMENGINE_UI(f) f##_ui
 #define SYMENGINE_SI(f) f##_si
@@ -305,6 +306,30 @@ public:
     {
         return mpz_fits_slong_p(mp);
     }
+    //! If the value fits into a signed long, stores it into `r` and returns
+    //! true. Only inspects the limbs, so it is cheaper than calling
+    //! fits_slong_p() followed by get_si().
+    inline bool get_si_if_fits(signed long &r) const
+    {
+        int size = mp->_mp_size;
+        if (size == 0) {
+            r = 0;
+            return true;
+        }
+        if (size != 1 and size != -1)
+            return false;
+        mp_limb_t limb = mp->_mp_d[0];
+        if (size == 1) {
+            if (limb > static_cast<mp_limb_t>(LONG_MAX))
+                return false;
+            r = static_cast<signed long>(limb);
+        } else {
+            if (limb > static_cast<mp_limb_t>(LONG_MAX) + 1u)
+                return false;
+            r = -static_cast<signed long>(limb - 1u) - 1;
+        }
+        return true;
+    }
 };
 
 class mpq_wrapper
@@ -1,13 +1,14 @@
 #include <symengine/add.h>
 #include <symengine/pow.h>
 #include <symengine/complex.h>
+#include <symengine/intern.h>
 #include <symengine/symengine_exception.h>
 #include <symengine/test_visitors.h>
 
 namespace SymEngine
 {
 
-Mul::Mul(const RCP<const Number> &coef, map_basic_basic &&dict)
+Mul::Mul(const RCP<const Number> &coef, fmap_basic_basic &&dict)
     : coef_{coef}, dict_{std::move(dict)}
 {
     SYMENGINE_ASSIGN_TYPEID()
@@ -15,7 +16,7 @@ Mul::Mul(const RCP<const Number> &coef, map_basic_basic &&dict)
 }
 
 bool Mul::is_canonical(const RCP<const Number> &coef,
-                       const map_basic_basic &dict) const
+                       const fmap_basic_basic &dict) const
 {
     if (coef == null)
         return false;
@@ -113,7 +114,7 @@ int Mul::compare(const Basic &o) const
 }
 
 RCP<const SymEngine::Basic> Mul::from_dict(const RCP<const Number> &coef,
-                                           map_basic_basic &&d)
+                                           fmap_basic_basic &&d)
 {
     if (coef->is_zero())
         return coef;
@@ -129,7 +130,7 @@ RCP<const SymEngine::Basic> Mul::from_dict(const RCP<const Number> &coef,
                 }
             } else {
                 // For coef*x or coef*x**3 we simply return Mul:
-                return make_rcp<const Mul>(coef, std::move(d));
+                return intern(make_rcp<const Mul>(coef, std::move(d)));
             }
         }
         if (coef->is_one()) {
@@ -137,17 +138,17 @@ RCP<const SymEngine::Basic> Mul::from_dict(const RCP<const Number> &coef,
             if (eq(*p->second, *one)) {
                 return p->first;
             }
-            return make_rcp<const Pow>(p->first, p->second);
+            return intern(make_rcp<const Pow>(p->first, p->second));
         } else {
-            return make_rcp<const Mul>(coef, std::move(d));
+            return intern(make_rcp<const Mul>(coef, std::move(d)));
         }
     } else {
-        return make_rcp<const Mul>(coef, std::move(d));
+        return intern(make_rcp<const Mul>(coef, std::move(d)));
     }
 }
 
 // Mul (t**exp) to the dict "d"
-void Mul::dict_add_term(map_basic_basic &d, const RCP<const Basic> &exp,
+void Mul::dict_add_term(fmap_basic_basic &d, const RCP<const Basic> &exp,
                         const RCP<const Basic> &t)
 {
     auto it = d.find(t);
@@ -175,7 +176,7 @@ void Mul::dict_add_term(map_basic_basic &d, const RCP<const Basic> &exp,
 
 // Mul (t**exp) to the dict "d"
 void Mul::dict_add_term_new(const Ptr<RCP<const Number>> &coef,
-                            map_basic_basic &d, const RCP<const Basic> &exp,
+                            fmap_basic_basic &d, const RCP<const Basic> &exp,
                             const RCP<const Basic> &t)
 {
     auto it = d.find(t);
@@ -312,8 +313,8 @@ void Mul::as_two_terms(const Ptr<RCP<const Basic>> &a,
     // Example: if this=3*x**2*y**2*z**2, then a=x**2 and b=3*y**2*z**2
     auto p = dict_.begin();
     *a = pow(p->first, p->second);
-    map_basic_basic d = dict_;
-    d.erase(p->first);
+    // The remaining factors are already sorted
+    fmap_basic_basic d(sorted_unique, std::next(p), dict_.end());
     *b = Mul::from_dict(coef_, std::move(d));
 }
 
@@ -351,7 +352,7 @@ void Mul::as_base_exp(const RCP<const Basic> &self,
 
 RCP<const Basic> mul(const RCP<const Basic> &a, const RCP<const Basic> &b)
 {
-    SymEngine::map_basic_basic d;
+    SymEngine::fmap_basic_basic d;
     RCP<const Number> coef = one;
     if (is_a<Mul>(*a) and is_a<Mul>(*b)) {
         RCP<const Mul> A = rcp_static_cast<const Mul>(a);
@@ -406,26 +407,41 @@ RCP<const Basic> mul(const RCP<const Basic> &a, const RCP<const Basic> &b)
     return Mul::from_dict(coef, std::move(d));
 }
 
+MulBuilder::MulBuilder() : coef_(one) {}
+
+MulBuilder &MulBuilder::operator*=(const RCP<const Basic> &factor)
+{
+    if (is_a<Mul>(*factor)) {
+        const Mul &A = down_cast<const Mul &>(*factor);
+        imulnum(outArg(coef_), A.get_coef());
+        for (const auto &p : A.get_dict())
+            Mul::dict_add_term_new(outArg(coef_), dict_, p.second, p.first);
+    } else if (is_a_Number(*factor)) {
+        imulnum(outArg(coef_), rcp_static_cast<const Number>(factor));
+    } else {
+        RCP<const Basic> exp;
+        RCP<const Basic> t;
+        Mul::as_base_exp(factor, outArg(exp), outArg(t));
+        Mul::dict_add_term_new(outArg(coef_), dict_, exp, t);
+    }
+    return *this;
+}
+
+RCP<const Basic> MulBuilder::build()
+{
+    RCP<const Basic> r = Mul::from_dict(coef_, std::move(dict_));
+    coef_ = one;
+    dict_.clear();
+    return r;
+}
+
 RCP<const Basic> mul(const vec_basic &a)
 {
-    SymEngine::map_basic_basic d;
-    RCP<const Number> coef = one;
+    MulBuilder b;
     for (const auto &i : a) {
-        if (is_a<Mul>(*i)) {
-            RCP<const Mul> A = rcp_static_cast<const Mul>(i);
-            imulnum(outArg(coef), A->get_coef());
-            for (const auto &p : A->get_dict())
-                Mul::dict_add_term_new(outArg(coef), d, p.second, p.first);
-        } else if (is_a_Number(*i)) {
-            imulnum(outArg(coef), rcp_static_cast<const Number>(i));
-        } else {
-            RCP<const Basic> exp;
-            RCP<const Basic> t;
-            Mul::as_base_exp(i, outArg(exp), outArg(t));
-            Mul::dict_add_term_new(outArg(coef), d, exp, t);
-        }
+        b *= i;
     }
-    return Mul::from_dict(coef, std::move(d));
+    return b.build();
 }
 
 RCP<const Basic> div(const RCP<const Basic> &a, const RCP<const Basic> &b)
@@ -445,7 +461,7 @@ RCP<const Basic> neg(const RCP<const Basic> &a)
     return mul(minus_one, a);
 }
 
-void Mul::power_num(const Ptr<RCP<const Number>> &coef, map_basic_basic &d,
+void Mul::power_num(const Ptr<RCP<const Number>> &coef, fmap_basic_basic &d,
                     const RCP<const Number> &exp) const
 {
     if (exp->is_zero()) {
@@ -474,13 +490,13 @@ void Mul::power_num(const Ptr<RCP<const Number>> &coef, map_basic_basic &d,
         if (coef_->is_negative() and not coef_->is_minus_one()) {
             // (-3*x*y)**(1/2) -> 3**(1/2)*(-x*y)**(1/2)
             new_coef = pow(coef_->mul(*minus_one), exp);
-            map_basic_basic d1 = dict_;
+            fmap_basic_basic d1 = dict_;
             Mul::dict_add_term_new(coef, d, exp,
                                    Mul::from_dict(minus_one, std::move(d1)));
         } else if (coef_->is_positive() and not coef_->is_one()) {
             // (3*x*y)**(1/2) -> 3**(1/2)*(x*y)**(1/2)
             new_coef = pow(coef_, exp);
-            map_basic_basic d1 = dict_;
+            fmap_basic_basic d1 = dict_;
             Mul::dict_add_term_new(coef, d, exp,
                                    Mul::from_dict(one, std::move(d1)));
         } else {
@@ -523,4 +539,17 @@ vec_basic Mul::get_args() const
     return args;
 }
 
+void Mul::for_each_arg(const arg_callback &f) const
+{
+    if (not coef_->is_one())
+        f(coef_);
+    for (const auto &p : dict_) {
+        if (eq(*p.second, *one)) {
+            f(p.first);
+        } else {
+            f(make_rcp<const Pow>(p.first, p.second));
+        }
+    }
+}
+
 } // namespace SymEngine
@@ -74,14 +74,14 @@ class Mul : public Basic
 {
 private:
     RCP<const Number> coef_; //! The coefficient (e.g. `2` in `2*x*y`)
-    map_basic_basic
+    fmap_basic_basic
         dict_; //! the dictionary of the rest (e.g. `x*y` in `2*x*y`)
 
 public:
     IMPLEMENT_TYPEID(SYMENGINE_MUL)
     //! Constructs Mul from a dictionary by copying the contents of the
     //! dictionary:
-    Mul(const RCP<const Number> &coef, map_basic_basic &&dict);
+    Mul(const RCP<const Number> &coef, fmap_basic_basic &&dict);
     //! \return size of the hash
     hash_t __hash__() const override;
     /*! Equality comparator
@@ -94,12 +94,12 @@ public:
     // Performs canonicalization first:
     //! Create a Mul from a dict
     static RCP<const Basic> from_dict(const RCP<const Number> &coef,
-                                      map_basic_basic &&d);
+                                      fmap_basic_basic &&d);
     //! Add terms to dict
-    static void dict_add_term(map_basic_basic &d, const RCP<const Basic> &exp,
+    static void dict_add_term(fmap_basic_basic &d, const RCP<const Basic> &exp,
                               const RCP<const Basic> &t);
     static void dict_add_term_new(const Ptr<RCP<const Number>> &coef,
-                                  map_basic_basic &d,
+                                  fmap_basic_basic &d,
                                   const RCP<const Basic> &exp,
                                   const RCP<const Basic> &t);
     //! Convert to a base and exponent form
@@ -113,24 +113,60 @@ public:
     void as_two_terms(const Ptr<RCP<const Basic>> &a,
                       const Ptr<RCP<const Basic>> &b) const;
     //! Power all terms with the exponent `exp`
-    void power_num(const Ptr<RCP<const Number>> &coef, map_basic_basic &d,
+    void power_num(const Ptr<RCP<const Number>> &coef, fmap_basic_basic &d,
                    const RCP<const Number> &exp) const;
 
     //! \return true if both `coef` and `dict` are in canonical form
     bool is_canonical(const RCP<const Number> &coef,
-                      const map_basic_basic &dict) const;
+                      const fmap_basic_basic &dict) const;
 
     vec_basic get_args() const override;
+    void for_each_arg(const arg_callback &f) const override;
 
     inline const RCP<const Number> &get_coef() const
     {
         return coef_;
     }
-    inline const map_basic_basic &get_dict() const
+    inline const fmap_basic_basic &get_dict() const
     {
         return dict_;
     }
 };
+
+/*! Accumulates a product in place
+
+    This is the multiplicative counterpart of `AddBuilder`: the factors and
+    the numeric coefficient are collected in a single dictionary, and the
+    canonical expression is created once by `build()`:
+
+        MulBuilder b;
+        for (const auto &factor : factors)
+            b *= factor;
+        RCP<const Basic> product = b.build();
+*/
+class MulBuilder
+{
+private:
+    RCP<const Number> coef_;
+    fmap_basic_basic dict_;
+
+public:
+    MulBuilder();
+
+    //! Multiplies the product by `factor`
+    MulBuilder &operator*=(const RCP<const Basic> &factor);
+
+    //! Makes room for `n` factors
+    inline void reserve(size_t n)
+    {
+        dict_.reserve(n);
+    }
+
+    //! \return the product of all the factors so far, in canonical form.
+    //! The builder is empty (one) afterwards.
+    RCP<const Basic> build();
+};
+
 //! Multiplication
 RCP<const Basic> mul(const RCP<const Basic> &a, const RCP<const Basic> &b);
 RCP<const Basic> mul(const vec_basic &a);
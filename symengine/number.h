@@ -67,6 +67,7 @@ public:
     {
         return {};
     }
+    void for_each_arg(const arg_callback &f) const override {}
 
     virtual bool is_perfect_power(bool is_expected = false) const
     {
@@ -3,6 +3,7 @@
 
 #include <symengine/basic.h>
 #include <symengine/polys/basic_conversions.h>
+#include <symengine/polys/msymenginepoly.h>
 
 namespace SymEngine
 {
@@ -17,7 +18,7 @@ inline void cancel(const RCP<const Basic> &numer, const RCP<const Basic> &denom,
     umap_basic_num numer_gens = _find_gens_poly(numer);
     umap_basic_num denom_gens = _find_gens_poly(denom);
 
-    if (numer_gens.size() != 1 && denom_gens.size() != 1) {
+    if (numer_gens.size() != 1 or denom_gens.size() != 1) {
         // only considering univariate here
         return;
     }
@@ -35,5 +36,27 @@ inline void cancel(const RCP<const Basic> &numer, const RCP<const Basic> &denom,
     divides_upoly(*gcd_poly, *denom_poly, outArg(*result_denom));
     *common = gcd_poly;
 }
+
+// Multivariate cancel, both sides are converted using the generators of
+// their product
+inline void cancel(const RCP<const Basic> &numer, const RCP<const Basic> &denom,
+                   const Ptr<RCP<const MIntPoly>> &result_numer,
+                   const Ptr<RCP<const MIntPoly>> &result_denom,
+                   const Ptr<RCP<const MIntPoly>> &common)
+{
+    umap_basic_num gens_map = _find_gens_poly(mul(numer, denom));
+    set_basic gens;
+    for (const auto &it : gens_map)
+        gens.insert(pow(it.first, it.second));
+
+    RCP<const MIntPoly> numer_poly = from_basic<MIntPoly>(numer, gens);
+    RCP<const MIntPoly> denom_poly = from_basic<MIntPoly>(denom, gens);
+
+    RCP<const MIntPoly> gcd_poly = gcd_mpoly(*numer_poly, *denom_poly);
+
+    divides_mpoly(*gcd_poly, *numer_poly, result_numer);
+    divides_mpoly(*gcd_poly, *denom_poly, result_denom);
+    *common = gcd_poly;
+}
 } // namespace SymEngine
 #endif // SYMENGINE_CANCEL_H
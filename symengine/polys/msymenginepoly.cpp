@@ -1,8 +1,628 @@
 #include <symengine/polys/msymenginepoly.h>
 
+#include <algorithm>
+#include <cstdint>
+
 namespace SymEngine
 {
 
+namespace
+{
+
+// Polynomials over Z_p, with p < 2**32 so that the product of two residues
+// fits into 64 bits. A multivariate polynomial keeps its terms in
+// descending lexicographic order, so that the first one is the leading term.
+typedef std::map<vec_uint, uint64_t, std::greater<vec_uint>> mpoly_p;
+// A dense univariate polynomial, lowest degree first
+typedef std::vector<uint64_t> upoly_p;
+// A polynomial in x_0, ..., x_{k-1} with coefficients in Z_p[x_k], the
+// exponent of x_k in the keys is zero
+typedef std::map<vec_uint, upoly_p, std::greater<vec_uint>> rpoly_p;
+// Same as `mpoly_p` over the integers
+typedef std::map<vec_uint, integer_class, std::greater<vec_uint>> mpoly_z;
+
+uint64_t inv_mod(uint64_t a, uint64_t p)
+{
+    int64_t t = 0, newt = 1, r = p, newr = a, q, tmp;
+    while (newr != 0) {
+        q = r / newr;
+        tmp = t - q * newt;
+        t = newt;
+        newt = tmp;
+        tmp = r - q * newr;
+        r = newr;
+        newr = tmp;
+    }
+    return t < 0 ? t + p : t;
+}
+
+void trim(upoly_p &a)
+{
+    while (not a.empty() and a.back() == 0)
+        a.pop_back();
+}
+
+uint64_t eval_up(const upoly_p &a, uint64_t x, uint64_t p)
+{
+    uint64_t r = 0;
+    for (size_t i = a.size(); i-- > 0;)
+        r = (r * x + a[i]) % p;
+    return r;
+}
+
+upoly_p mul_up(const upoly_p &a, const upoly_p &b, uint64_t p)
+{
+    if (a.empty() or b.empty())
+        return {};
+    upoly_p r(a.size() + b.size() - 1, 0);
+    for (size_t i = 0; i < a.size(); i++)
+        for (size_t j = 0; j < b.size(); j++)
+            r[i + j] = (r[i + j] + a[i] * b[j]) % p;
+    return r;
+}
+
+// Divides `a` by `b` in place, leaving the remainder in `a`, and returns
+// the quotient
+upoly_p divrem_up(upoly_p &a, const upoly_p &b, uint64_t p)
+{
+    if (a.size() < b.size())
+        return {};
+    upoly_p q(a.size() - b.size() + 1, 0);
+    uint64_t inv = inv_mod(b.back(), p);
+    for (size_t i = a.size(); i-- >= b.size();) {
+        uint64_t c = a[i] * inv % p;
+        size_t k = i + 1 - b.size();
+        q[k] = c;
+        if (c == 0)
+            continue;
+        for (size_t j = 0; j < b.size(); j++)
+            a[k + j] = (a[k + j] + (p - c) * b[j]) % p;
+    }
+    trim(a);
+    return q;
+}
+
+// The monic gcd of `a` and `b`
+upoly_p gcd_up(upoly_p a, upoly_p b, uint64_t p)
+{
+    while (not b.empty()) {
+        divrem_up(a, b, p);
+        a.swap(b);
+    }
+    if (a.empty())
+        return a;
+    uint64_t inv = inv_mod(a.back(), p);
+    for (auto &c : a)
+        c = c * inv % p;
+    return a;
+}
+
+rpoly_p split(const mpoly_p &f, unsigned k)
+{
+    rpoly_p r;
+    for (const auto &t : f) {
+        vec_uint e = t.first;
+        unsigned d = e[k];
+        e[k] = 0;
+        upoly_p &c = r[e];
+        if (c.size() <= d)
+            c.resize(d + 1, 0);
+        c[d] = t.second;
+    }
+    return r;
+}
+
+mpoly_p join(const rpoly_p &f, unsigned k)
+{
+    mpoly_p r;
+    for (const auto &t : f) {
+        vec_uint e = t.first;
+        for (unsigned d = 0; d < t.second.size(); d++) {
+            if (t.second[d] == 0)
+                continue;
+            e[k] = d;
+            r.insert({e, t.second[d]});
+        }
+    }
+    return r;
+}
+
+unsigned degree(const mpoly_p &f, unsigned k)
+{
+    unsigned d = 0;
+    for (const auto &t : f)
+        d = std::max(d, t.first[k]);
+    return d;
+}
+
+// The gcd of the coefficients of `f`
+upoly_p content(const rpoly_p &f, uint64_t p)
+{
+    upoly_p c;
+    for (const auto &t : f) {
+        c = gcd_up(c, t.second, p);
+        if (c.size() == 1)
+            break;
+    }
+    return c;
+}
+
+void divide_coeffs(rpoly_p &f, const upoly_p &c, uint64_t p)
+{
+    if (c.size() == 1)
+        return;
+    for (auto &t : f)
+        t.second = divrem_up(t.second, c, p);
+}
+
+mpoly_p evaluate(const rpoly_p &f, uint64_t x, uint64_t p)
+{
+    mpoly_p r;
+    for (const auto &t : f) {
+        uint64_t c = eval_up(t.second, x, p);
+        if (c != 0)
+            r.insert({t.first, c});
+    }
+    return r;
+}
+
+// true if `d` divides `f`
+bool divides_modp(const mpoly_p &d, mpoly_p f, uint64_t p)
+{
+    const vec_uint &lm = d.begin()->first;
+    uint64_t inv = inv_mod(d.begin()->second, p);
+    vec_uint e(lm.size());
+    while (not f.empty()) {
+        const vec_uint &m = f.begin()->first;
+        for (size_t i = 0; i < m.size(); i++) {
+            if (m[i] < lm[i])
+                return false;
+            e[i] = m[i] - lm[i];
+        }
+        uint64_t c = p - f.begin()->second * inv % p;
+        for (const auto &t : d) {
+            vec_uint m2 = t.first;
+            for (size_t i = 0; i < m2.size(); i++)
+                m2[i] += e[i];
+            uint64_t &r = f[m2];
+            r = (r + c * t.second) % p;
+            if (r == 0)
+                f.erase(m2);
+        }
+    }
+    return true;
+}
+
+void make_monic(mpoly_p &f, uint64_t p)
+{
+    uint64_t inv = inv_mod(f.begin()->second, p);
+    for (auto &t : f)
+        t.second = t.second * inv % p;
+}
+
+// The monic gcd of the nonzero `f` and `g` in Z_p[x_0, ..., x_k], by Brown's
+// dense modular algorithm: x_k is eliminated by evaluating it at successive
+// points, and the gcd is interpolated back from the images.
+mpoly_p gcd_modp(const mpoly_p &f, const mpoly_p &g, unsigned k, uint64_t p)
+{
+    if (k == 0) {
+        upoly_p a(f.begin()->first[0] + 1, 0), b(g.begin()->first[0] + 1, 0);
+        for (const auto &t : f)
+            a[t.first[0]] = t.second;
+        for (const auto &t : g)
+            b[t.first[0]] = t.second;
+        rpoly_p r;
+        r[vec_uint(f.begin()->first.size(), 0)] = gcd_up(a, b, p);
+        return join(r, 0);
+    }
+    unsigned df = degree(f, k), dg = degree(g, k);
+    if (df == 0 and dg == 0)
+        return gcd_modp(f, g, k - 1, p);
+
+    rpoly_p F = split(f, k), G = split(g, k);
+    upoly_p cf = content(F, p), cg = content(G, p);
+    upoly_p c = gcd_up(cf, cg, p);
+    divide_coeffs(F, cf, p);
+    divide_coeffs(G, cg, p);
+    mpoly_p pf = join(F, k), pg = join(G, k);
+
+    // The leading coefficient of the gcd of the primitive parts divides
+    // `gamma`, the images are scaled to it before the interpolation. Then
+    // `bound` bounds its degree in x_k.
+    upoly_p gamma = gcd_up(F.begin()->second, G.begin()->second, p);
+    size_t bound = std::min(df - (cf.size() - 1), dg - (cg.size() - 1))
+                   + gamma.size() - 1;
+
+    rpoly_p H;
+    upoly_p m = {1};
+    vec_uint lm;
+    for (uint64_t a = 0; a < p; a++) {
+        uint64_t s = eval_up(gamma, a, p);
+        if (s == 0)
+            continue;
+        mpoly_p ha = gcd_modp(evaluate(F, a, p), evaluate(G, a, p), k - 1, p);
+        if (ha.size() == 1
+            and ha.begin()->first == vec_uint(ha.begin()->first.size(), 0)) {
+            // The primitive parts are coprime
+            rpoly_p r;
+            r[ha.begin()->first] = c;
+            return join(r, k);
+        }
+        if (not lm.empty() and ha.begin()->first > lm)
+            continue; // unlucky point
+        if (lm.empty() or ha.begin()->first < lm) {
+            // All the previous points were unlucky
+            lm = ha.begin()->first;
+            H.clear();
+            m = {1};
+        }
+
+        // Newton interpolation: H += (s*ha - H(a)) * m / m(a)
+        uint64_t minv = inv_mod(eval_up(m, a, p), p);
+        for (const auto &t : ha)
+            H[t.first];
+        bool changed = false;
+        for (auto &t : H) {
+            auto it = ha.find(t.first);
+            uint64_t v = it == ha.end() ? 0 : it->second * s % p;
+            uint64_t d = (v + p - eval_up(t.second, a, p)) * minv % p;
+            if (d == 0)
+                continue;
+            changed = true;
+            if (t.second.size() < m.size())
+                t.second.resize(m.size(), 0);
+            for (size_t i = 0; i < m.size(); i++)
+                t.second[i] = (t.second[i] + d * m[i]) % p;
+            trim(t.second);
+        }
+        m = mul_up(m, {p - a, 1}, p);
+
+        // The candidate is checked once it stops changing, or when there
+        // are enough points to determine it
+        if (changed and m.size() <= bound + 1)
+            continue;
+        rpoly_p Hp = H;
+        divide_coeffs(Hp, content(Hp, p), p);
+        mpoly_p h = join(Hp, k);
+        if (divides_modp(h, pf, p) and divides_modp(h, pg, p)) {
+            for (auto &t : Hp)
+                t.second = mul_up(t.second, c, p);
+            h = join(Hp, k);
+            make_monic(h, p);
+            return h;
+        }
+    }
+    throw SymEngineException("gcd: ran out of evaluation points");
+}
+
+// true & stores f/d into `q` (unless null) if the nonzero `d` divides `f`
+bool divides_z(const mpoly_z &d, mpoly_z f, mpoly_z *q)
+{
+    const vec_uint &lm = d.begin()->first;
+    const integer_class &lc = d.begin()->second;
+    vec_uint e(lm.size());
+    integer_class c, r;
+    while (not f.empty()) {
+        const vec_uint &m = f.begin()->first;
+        for (size_t i = 0; i < m.size(); i++) {
+            if (m[i] < lm[i])
+                return false;
+            e[i] = m[i] - lm[i];
+        }
+        mp_tdiv_qr(c, r, f.begin()->second, lc);
+        if (r != 0)
+            return false;
+        if (q != nullptr)
+            q->insert({e, c});
+        c = -c;
+        for (const auto &t : d) {
+            vec_uint m2 = t.first;
+            for (size_t i = 0; i < m2.size(); i++)
+                m2[i] += e[i];
+            integer_class &x = f[m2];
+            mp_addmul(x, c, t.second);
+            if (x == 0)
+                f.erase(m2);
+        }
+    }
+    return true;
+}
+
+// The content of `f`, with the sign of the leading coefficient
+integer_class content(const mpoly_z &f)
+{
+    integer_class c(0);
+    for (const auto &t : f) {
+        mp_gcd(c, c, t.second);
+        if (c == 1)
+            break;
+    }
+    if (f.begin()->second < 0)
+        c = -c;
+    return c;
+}
+
+mpoly_z to_lex(const MIntDict &a)
+{
+    return mpoly_z(a.dict_.begin(), a.dict_.end());
+}
+
+MIntDict from_lex(const mpoly_z &a, unsigned vec_size)
+{
+    umap_uvec_mpz d;
+    for (const auto &t : a)
+        d.insert(t);
+    return MIntDict(std::move(d), vec_size);
+}
+
+} // namespace
+
+MIntDict MIntDict::gcd(const MIntDict &a, const MIntDict &b)
+{
+    SYMENGINE_ASSERT(a.vec_size == b.vec_size)
+    unsigned n = a.vec_size;
+    if (a.empty() or b.empty()) {
+        mpoly_z r = to_lex(a.empty() ? b : a);
+        if (not r.empty() and r.begin()->second < 0)
+            for (auto &t : r)
+                t.second = -t.second;
+        return from_lex(r, n);
+    }
+    mpoly_z f = to_lex(a), g = to_lex(b);
+    integer_class cf = content(f), cg = content(g), c;
+    mp_gcd(c, cf, cg);
+    for (auto &t : f)
+        mp_divexact(t.second, t.second, cf);
+    for (auto &t : g)
+        mp_divexact(t.second, t.second, cg);
+    const vec_uint zero_v(n, 0);
+    if (f.begin()->first == zero_v or g.begin()->first == zero_v)
+        return from_lex({{zero_v, c}}, n);
+
+    // As in `UIntDict::gcd`, the gcd of the primitive parts is computed
+    // modulo word sized primes, with the images normalized to `gamma`, and
+    // lifted by Chinese remaindering until it stops changing and divides
+    // both.
+    integer_class gamma;
+    mp_gcd(gamma, f.begin()->second, g.begin()->second);
+
+    mpoly_z h;
+    vec_uint lm;
+    integer_class m, p(1), mprod, minv, t, half;
+    p <<= 31;
+    while (true) {
+        mp_nextprime(p, p);
+        mp_fdiv_r(t, gamma, p);
+        if (t == 0)
+            continue;
+        uint64_t pp = mp_get_ui(p), s = mp_get_ui(t);
+        mpoly_p fp, gp;
+        for (const auto &x : f) {
+            mp_fdiv_r(t, x.second, p);
+            if (t != 0)
+                fp.insert({x.first, mp_get_ui(t)});
+        }
+        for (const auto &x : g) {
+            mp_fdiv_r(t, x.second, p);
+            if (t != 0)
+                gp.insert({x.first, mp_get_ui(t)});
+        }
+        mpoly_p hp = gcd_modp(fp, gp, n - 1, pp);
+        if (hp.begin()->first == zero_v)
+            return from_lex({{zero_v, c}}, n);
+        if (not lm.empty() and hp.begin()->first > lm)
+            continue; // unlucky prime
+        if (lm.empty() or hp.begin()->first < lm) {
+            // All the previous primes were unlucky
+            lm = hp.begin()->first;
+            h.clear();
+            m = p;
+            half = m >> 1;
+            for (const auto &x : hp) {
+                integer_class &y = h[x.first];
+                y = x.second * s % pp;
+                if (y > half)
+                    y -= m;
+            }
+            continue;
+        }
+        mp_invert(minv, m, p);
+        mprod = m * p;
+        half = mprod >> 1;
+        for (const auto &x : hp)
+            h[x.first];
+        bool changed = false;
+        for (auto &x : h) {
+            auto it = hp.find(x.first);
+            t = it == hp.end() ? 0 : it->second * s % pp;
+            t -= x.second;
+            t *= minv;
+            mp_fdiv_r(t, t, p);
+            if (t == 0)
+                continue;
+            changed = true;
+            mp_addmul(x.second, m, t);
+            if (x.second > half)
+                x.second -= mprod;
+        }
+        m = mprod;
+        if (changed)
+            continue;
+        mpoly_z r;
+        for (const auto &x : h)
+            if (x.second != 0)
+                r.insert(x);
+        integer_class cr = content(r);
+        for (auto &x : r)
+            mp_divexact(x.second, x.second, cr);
+        if (divides_z(r, f, nullptr) and divides_z(r, g, nullptr)) {
+            for (auto &x : r)
+                x.second *= c;
+            return from_lex(r, n);
+        }
+    }
+}
+
+bool MIntDict::divides(const MIntDict &a, const MIntDict &b, MIntDict &q)
+{
+    SYMENGINE_ASSERT(a.vec_size == b.vec_size)
+    if (a.empty())
+        return false;
+    mpoly_z r;
+    if (not divides_z(to_lex(a), to_lex(b), &r))
+        return false;
+    q = from_lex(r, a.vec_size);
+    return true;
+}
+
+namespace
+{
+
+// A term of a product in the heap of `MIntDict::mul`, the product of the
+// `i`-th term of the first factor with the `j`-th term of the second one
+struct HeapTerm {
+    uint64_t exp;
+    unsigned i, j;
+};
+
+// A binary max-heap on `exp`, with the children of `h[k]` at 2k+1 and 2k+2
+void heap_push(std::vector<HeapTerm> &h, const HeapTerm &t)
+{
+    size_t k = h.size();
+    h.push_back(t);
+    while (k > 0 and h[(k - 1) / 2].exp < t.exp) {
+        h[k] = h[(k - 1) / 2];
+        k = (k - 1) / 2;
+    }
+    h[k] = t;
+}
+
+// Replaces the top of the heap by `t`
+void heap_replace_top(std::vector<HeapTerm> &h, const HeapTerm &t)
+{
+    size_t k = 0, n = h.size();
+    while (2 * k + 1 < n) {
+        size_t l = 2 * k + 1;
+        if (l + 1 < n and h[l].exp < h[l + 1].exp)
+            l++;
+        if (h[l].exp <= t.exp)
+            break;
+        h[k] = h[l];
+        k = l;
+    }
+    h[k] = t;
+}
+
+void heap_pop(std::vector<HeapTerm> &h)
+{
+    HeapTerm t = h.back();
+    h.pop_back();
+    if (not h.empty())
+        heap_replace_top(h, t);
+}
+
+// The terms of `d` in descending order, with the exponents packed into a
+// word by shifting the exponent of the `i`-th variable by `shift[i]`
+typedef std::vector<std::pair<uint64_t, const integer_class *>> packed_terms;
+
+packed_terms pack(const umap_uvec_mpz &d, const std::vector<unsigned> &shift)
+{
+    packed_terms v;
+    v.reserve(d.size());
+    for (const auto &t : d) {
+        uint64_t e = 0;
+        for (unsigned i = 0; i < shift.size(); i++)
+            e |= uint64_t(t.first[i]) << shift[i];
+        v.push_back({e, &t.second});
+    }
+    std::sort(v.begin(), v.end(),
+              [](const packed_terms::value_type &x,
+                 const packed_terms::value_type &y) {
+                  return x.first > y.first;
+              });
+    return v;
+}
+
+} // namespace
+
+MIntDict MIntDict::mul(const MIntDict &a, const MIntDict &b)
+{
+    SYMENGINE_ASSERT(a.vec_size == b.vec_size)
+    unsigned n = a.vec_size;
+    if (a.empty() or b.empty())
+        return MIntDict(n);
+
+    // The exponents are packed into a single word, with a field wide enough
+    // for the degree of the product in each variable. The first variable
+    // takes the highest bits, so that comparing the words compares the
+    // monomials lexicographically.
+    vec_uint da(n, 0), db(n, 0);
+    for (const auto &t : a.dict_)
+        for (unsigned i = 0; i < n; i++)
+            da[i] = std::max(da[i], t.first[i]);
+    for (const auto &t : b.dict_)
+        for (unsigned i = 0; i < n; i++)
+            db[i] = std::max(db[i], t.first[i]);
+    std::vector<unsigned> shift(n);
+    std::vector<uint64_t> mask(n);
+    unsigned bits = 0;
+    for (unsigned i = n; i-- > 0;) {
+        uint64_t d = uint64_t(da[i]) + db[i];
+        unsigned w = 0;
+        while (d >> w != 0)
+            w++;
+        shift[i] = bits;
+        mask[i] = (uint64_t(1) << w) - 1;
+        bits += w;
+        if (bits > 64)
+            return UDictWrapper::mul(a, b);
+    }
+
+    // The heap holds at most one term per term of `f`, so `f` is the
+    // factor with fewer terms
+    bool swapped = a.dict_.size() > b.dict_.size();
+    packed_terms f = pack(swapped ? b.dict_ : a.dict_, shift);
+    packed_terms g = pack(swapped ? a.dict_ : b.dict_, shift);
+
+    // The terms of the product are generated in descending order by a heap
+    // merge of the rows f[i]*g (Johnson's algorithm, as used by Monagan and
+    // Pearce), so equal monomials come out together and are summed in place.
+    // The heap starts with f[0]*g[0], and the row f[i+1]*g enters it when
+    // f[i]*g[0] leaves.
+    std::vector<std::pair<uint64_t, integer_class>> terms;
+    std::vector<HeapTerm> heap;
+    heap.reserve(f.size());
+    heap.push_back({f[0].first + g[0].first, 0, 0});
+    integer_class c;
+    while (not heap.empty()) {
+        uint64_t exp = heap[0].exp;
+        c = 0;
+        do {
+            HeapTerm t = heap[0];
+            mp_addmul(c, *f[t.i].second, *g[t.j].second);
+            if (t.j == 0 and t.i + 1 < f.size())
+                heap_push(heap, {f[t.i + 1].first + g[0].first, t.i + 1, 0});
+            if (t.j + 1 < g.size())
+                heap_replace_top(
+                    heap, {f[t.i].first + g[t.j + 1].first, t.i, t.j + 1});
+            else
+                heap_pop(heap);
+        } while (not heap.empty() and heap[0].exp == exp);
+        if (c != 0)
+            terms.push_back({exp, std::move(c)});
+    }
+
+    MIntDict p(n);
+    p.dict_.reserve(terms.size());
+    vec_uint e(n);
+    for (auto &t : terms) {
+        for (unsigned i = 0; i < n; i++)
+            e[i] = static_cast<unsigned>((t.first >> shift[i]) & mask[i]);
+        p.dict_.insert({e, std::move(t.second)});
+    }
+    return p;
+}
+
 RCP<const Basic> MIntPoly::as_symbolic() const
 {
     vec_basic args;
@@ -127,4 +747,22 @@ unsigned int reconcile(vec_uint &v1, vec_uint &v2, set_basic &s,
     return pos;
 }
 
+RCP<const MIntPoly> gcd_mpoly(const MIntPoly &a, const MIntPoly &b)
+{
+    MIntDict x, y;
+    set_basic s = get_translated_container(x, y, a, b);
+    return MIntPoly::from_container(s, MIntDict::gcd(x, y));
+}
+
+bool divides_mpoly(const MIntPoly &a, const MIntPoly &b,
+                   const Ptr<RCP<const MIntPoly>> &res)
+{
+    MIntDict x, y, q;
+    set_basic s = get_translated_container(x, y, a, b);
+    if (not MIntDict::divides(x, y, q))
+        return false;
+    *res = MIntPoly::from_container(s, std::move(q));
+    return true;
+}
+
 } // namespace SymEngine
@@ -31,6 +31,15 @@ public:
 
     ~UDictWrapper() SYMENGINE_NOEXCEPT {}
 
+    UDictWrapper(const UDictWrapper &) = default;
+
+    UDictWrapper &operator=(const UDictWrapper &) = default;
+
+    UDictWrapper(UDictWrapper &&other) SYMENGINE_NOEXCEPT
+        : dict_(std::move(other.dict_)), vec_size(other.vec_size)
+    {
+    }
+
     UDictWrapper(Dict &&p, unsigned int sz)
     {
         auto iter = p.begin();
@@ -281,6 +290,18 @@ public:
     MIntDict(const MIntDict &) = default;
 
     MIntDict &operator=(const MIntDict &) = default;
+
+    //! Multiplies the terms in lexicographic order by a heap merge on
+    //! exponents packed into a word, or falls back to
+    //! `UDictWrapper::mul` when the exponents of the product do not fit.
+    static MIntDict mul(const MIntDict &a, const MIntDict &b);
+
+    //! \return the gcd of `a` and `b`, with a positive leading coefficient
+    //! in the lexicographic order. Uses Brown's dense modular algorithm.
+    static MIntDict gcd(const MIntDict &a, const MIntDict &b);
+
+    //! true & sets `q` to b/a if `a` exactly divides `b`
+    static bool divides(const MIntDict &a, const MIntDict &b, MIntDict &q);
 };
 
 class MExprDict : public UDictWrapper<vec_int, Expression, MExprDict>
@@ -528,6 +549,12 @@ RCP<const Poly> pow_mpoly(const Poly &a, unsigned int n)
     auto x = a.get_poly();
     return Poly::from_container(a.get_vars(), Poly::container_type::pow(x, n));
 }
+
+RCP<const MIntPoly> gcd_mpoly(const MIntPoly &a, const MIntPoly &b);
+
+// true & sets `res` to b/a if a exactly divides b, otherwise false & undefined
+bool divides_mpoly(const MIntPoly &a, const MIntPoly &b,
+                   const Ptr<RCP<const MIntPoly>> &res);
 } // namespace SymEngine
 
 #endif
@@ -1,8 +1,432 @@
 #include <symengine/polys/uintpoly.h>
+#include <symengine/fields.h>
+
+#include <algorithm>
+#include <cstdint>
 
 namespace SymEngine
 {
 
+namespace
+{
+
+typedef std::vector<integer_class> dense_poly;
+
+dense_poly to_dense(const map_uint_mpz &d)
+{
+    dense_poly v(d.rbegin()->first + 1, integer_class(0));
+    for (const auto &p : d)
+        v[p.first] = p.second;
+    return v;
+}
+
+// The content of `v`, with the sign of the leading coefficient
+integer_class content(const dense_poly &v)
+{
+    integer_class c(0);
+    for (const auto &x : v) {
+        mp_gcd(c, c, x);
+        if (c == 1)
+            break;
+    }
+    if (v.back() < 0)
+        c = -c;
+    return c;
+}
+
+// true if `b` divides `a`, both primitive
+bool divides_dense(const dense_poly &b, dense_poly a)
+{
+    if (a.size() < b.size())
+        return false;
+    const integer_class &lc = b.back();
+    integer_class q, r;
+    for (size_t i = a.size(); i-- >= b.size();) {
+        if (a[i] == 0)
+            continue;
+        mp_tdiv_qr(q, r, a[i], lc);
+        if (r != 0)
+            return false;
+        q = -q;
+        size_t k = i + 1 - b.size();
+        for (size_t j = 0; j < b.size(); j++)
+            mp_addmul(a[k + j], q, b[j]);
+    }
+    for (size_t i = 0; i + 1 < b.size(); i++) {
+        if (a[i] != 0)
+            return false;
+    }
+    return true;
+}
+
+// Products with at most this many pairs of terms, or with fewer pairs than
+// coefficients, are multiplied term by term
+const size_t mul_schoolbook_pairs = 256;
+// Dense products are computed by Karatsuba from this length of the shorter
+// factor on when the number theoretic transform cannot be used, and by the
+// transform from `mul_ntt_threshold` on. Shorter ones are left to the
+// Kronecker substitution, where GMP's multiplication wins.
+const size_t mul_karatsuba_threshold = 128;
+const size_t mul_ntt_threshold = 512;
+// Karatsuba multiplies factors shorter than this by the basecase
+const size_t mul_karatsuba_basecase = 32;
+
+UIntDict mul_schoolbook(const UIntDict &a, const UIntDict &b)
+{
+    UIntDict r;
+    for (const auto &x : a.dict_)
+        for (const auto &y : b.dict_)
+            mp_addmul(r.dict_[x.first + y.first], x.second, y.second);
+    for (auto it = r.dict_.begin(); it != r.dict_.end();) {
+        if (it->second == 0)
+            it = r.dict_.erase(it);
+        else
+            ++it;
+    }
+    return r;
+}
+
+UIntDict from_dense(dense_poly &v)
+{
+    UIntDict r;
+    for (unsigned i = 0; i < v.size(); i++)
+        if (v[i] != 0)
+            r.dict_.emplace_hint(r.dict_.end(), i, std::move(v[i]));
+    return r;
+}
+
+// r[0, na + nb - 1) += a[0, na) * b[0, nb)
+void mul_basecase(const integer_class *a, size_t na, const integer_class *b,
+                  size_t nb, integer_class *r)
+{
+    for (size_t i = 0; i < na; i++) {
+        if (a[i] == 0)
+            continue;
+        for (size_t j = 0; j < nb; j++)
+            mp_addmul(r[i + j], a[i], b[j]);
+    }
+}
+
+// r[0, na + nb - 1) += a[0, na) * b[0, nb)
+void mul_karatsuba(const integer_class *a, size_t na, const integer_class *b,
+                   size_t nb, integer_class *r)
+{
+    if (na < nb) {
+        std::swap(a, b);
+        std::swap(na, nb);
+    }
+    if (nb < mul_karatsuba_basecase) {
+        mul_basecase(a, na, b, nb, r);
+        return;
+    }
+    if (2 * nb <= na) {
+        // Unbalanced, `a` is multiplied by `b` in slices of length nb
+        for (size_t i = 0; i < na; i += nb)
+            mul_karatsuba(a + i, std::min(nb, na - i), b, nb, r + i);
+        return;
+    }
+    // a = a0 + x**m*a1, b = b0 + x**m*b1 and
+    // a*b = a0*b0 + x**m*((a0 + a1)*(b0 + b1) - a0*b0 - a1*b1) + x**2m*a1*b1
+    size_t m = na / 2;
+    size_t na1 = na - m, nb1 = nb - m;
+    dense_poly z0(2 * m - 1), z2(na1 + nb1 - 1), sa(na1), sb(na1), z1;
+    mul_karatsuba(a, m, b, m, z0.data());
+    mul_karatsuba(a + m, na1, b + m, nb1, z2.data());
+    for (size_t i = 0; i < na1; i++)
+        sa[i] = (i < m ? a[i] : integer_class(0)) + a[m + i];
+    for (size_t i = 0; i < na1; i++) {
+        sb[i] = i < m ? b[i] : integer_class(0);
+        if (i < nb1)
+            sb[i] += b[m + i];
+    }
+    z1.resize(2 * na1 - 1);
+    mul_karatsuba(sa.data(), na1, sb.data(), na1, z1.data());
+    for (size_t i = 0; i < z0.size(); i++) {
+        z1[i] -= z0[i];
+        r[i] += z0[i];
+    }
+    for (size_t i = 0; i < z2.size(); i++) {
+        z1[i] -= z2[i];
+        r[2 * m + i] += z2[i];
+    }
+    for (size_t i = 0; i < z1.size(); i++)
+        if (z1[i] != 0)
+            r[m + i] += z1[i];
+}
+
+// Arithmetic modulo an odd prime p < 2**31 in Montgomery form, with R = 2**32
+class MontgomeryField
+{
+public:
+    uint32_t p;
+
+    MontgomeryField(uint32_t p_) : p(p_)
+    {
+        // -1/p mod 2**32 by Newton iteration
+        uint32_t inv = p;
+        for (int i = 0; i < 4; i++)
+            inv *= 2 - p * inv;
+        pinv_ = ~inv + 1;
+        uint64_t r = (uint64_t(1) << 32) % p;
+        r2_ = static_cast<uint32_t>(r * r % p);
+    }
+
+    inline uint32_t reduce(uint64_t t) const
+    {
+        uint32_t m = static_cast<uint32_t>(t) * pinv_;
+        uint32_t u = static_cast<uint32_t>((t + uint64_t(m) * p) >> 32);
+        return u >= p ? u - p : u;
+    }
+    inline uint32_t mul(uint32_t a, uint32_t b) const
+    {
+        return reduce(uint64_t(a) * b);
+    }
+    inline uint32_t add(uint32_t a, uint32_t b) const
+    {
+        uint32_t c = a + b;
+        return c >= p ? c - p : c;
+    }
+    inline uint32_t sub(uint32_t a, uint32_t b) const
+    {
+        return a >= b ? a - b : a + p - b;
+    }
+    //! \return `a` (0 <= a < p) in Montgomery form
+    inline uint32_t to(uint32_t a) const
+    {
+        return reduce(uint64_t(a) * r2_);
+    }
+    inline uint32_t from(uint32_t a) const
+    {
+        return reduce(a);
+    }
+    uint32_t pow(uint32_t a, uint64_t n) const
+    {
+        uint32_t r = to(1);
+        while (n != 0) {
+            if (n & 1)
+                r = mul(r, a);
+            a = mul(a, a);
+            n >>= 1;
+        }
+        return r;
+    }
+
+private:
+    uint32_t pinv_, r2_;
+};
+
+// The primes p = c*2**ntt_max_log + 1 < 2**31 with a primitive root `g`,
+// in decreasing order and computed on first use. They allow transforms of
+// length up to 2**ntt_max_log.
+const unsigned ntt_max_log = 23;
+
+struct NTTPrime {
+    uint32_t p, g;
+};
+
+const std::vector<NTTPrime> &ntt_primes()
+{
+    static std::vector<NTTPrime> *primes = [] {
+        auto v = new std::vector<NTTPrime>();
+        for (uint32_t c = (1u << (31 - ntt_max_log)) - 1; c > 0; c--) {
+            uint32_t p = (c << ntt_max_log) + 1;
+            if (not mp_probab_prime_p(integer_class(p), 25))
+                continue;
+            // The prime factors of p - 1 = c*2**ntt_max_log
+            std::vector<uint32_t> factors = {2};
+            uint32_t m = c;
+            for (uint32_t q = 3; q <= m; q += 2) {
+                if (m % q != 0)
+                    continue;
+                factors.push_back(q);
+                while (m % q == 0)
+                    m /= q;
+            }
+            MontgomeryField F(p);
+            uint32_t g = 2;
+            while (true) {
+                bool primitive = true;
+                for (uint32_t q : factors)
+                    if (F.pow(F.to(g), (p - 1) / q) == F.to(1))
+                        primitive = false;
+                if (primitive)
+                    break;
+                g++;
+            }
+            v->push_back({p, g});
+        }
+        return v;
+    }();
+    return *primes;
+}
+
+// In place transform of `a` (in Montgomery form), of length n = 2**k. The
+// inverse transform uses the inverse root and is not scaled by 1/n.
+void ntt(std::vector<uint32_t> &a, const MontgomeryField &F, uint32_t g,
+         bool inverse)
+{
+    size_t n = a.size();
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(a[i], a[j]);
+    }
+    std::vector<uint32_t> w(n / 2);
+    for (size_t len = 2; len <= n; len <<= 1) {
+        uint32_t root = F.pow(F.to(g), (F.p - 1) / len);
+        if (inverse)
+            root = F.pow(root, len - 1);
+        size_t half = len / 2;
+        w[0] = F.to(1);
+        for (size_t i = 1; i < half; i++)
+            w[i] = F.mul(w[i - 1], root);
+        for (size_t i = 0; i < n; i += len) {
+            for (size_t j = 0; j < half; j++) {
+                uint32_t u = a[i + j];
+                uint32_t v = F.mul(a[i + j + half], w[j]);
+                a[i + j] = F.add(u, v);
+                a[i + j + half] = F.sub(u, v);
+            }
+        }
+    }
+}
+
+// `v` modulo `p` in Montgomery form, zero padded to length `n`
+std::vector<uint32_t> reduce(const dense_poly &v, const MontgomeryField &F,
+                             size_t n)
+{
+    std::vector<uint32_t> r(n, 0);
+    integer_class t, p(F.p);
+    for (size_t i = 0; i < v.size(); i++) {
+        long c;
+        if (mp_fits_slong_p(v[i])) {
+            c = mp_get_si(v[i]) % static_cast<long>(F.p);
+        } else {
+            mp_fdiv_r(t, v[i], p);
+            c = static_cast<long>(mp_get_ui(t));
+        }
+        if (c < 0)
+            c += F.p;
+        r[i] = F.to(static_cast<uint32_t>(c));
+    }
+    return r;
+}
+
+// The product of `a` and `b` modulo the first `k` NTT primes, and
+// reconstructed by Chinese remaindering (Garner's algorithm) into
+// symmetric residues
+dense_poly mul_ntt(const dense_poly &a, const dense_poly &b, unsigned k)
+{
+    const std::vector<NTTPrime> &primes = ntt_primes();
+    size_t len = a.size() + b.size() - 1, n = 1;
+    while (n < len)
+        n <<= 1;
+
+    std::vector<std::vector<uint32_t>> res(k);
+    for (unsigned i = 0; i < k; i++) {
+        MontgomeryField F(primes[i].p);
+        std::vector<uint32_t> fa = reduce(a, F, n);
+        ntt(fa, F, primes[i].g, false);
+        if (&a == &b) {
+            for (size_t j = 0; j < n; j++)
+                fa[j] = F.mul(fa[j], fa[j]);
+        } else {
+            std::vector<uint32_t> fb = reduce(b, F, n);
+            ntt(fb, F, primes[i].g, false);
+            for (size_t j = 0; j < n; j++)
+                fa[j] = F.mul(fa[j], fb[j]);
+        }
+        ntt(fa, F, primes[i].g, true);
+        // Scaling by 1/n and leaving the Montgomery form at once
+        uint32_t ninv = F.pow(F.to(static_cast<uint32_t>(n)), F.p - 2);
+        for (size_t j = 0; j < len; j++)
+            fa[j] = F.from(F.mul(fa[j], ninv));
+        fa.resize(len);
+        res[i].swap(fa);
+    }
+
+    // inv[i][j] = 1/p_i mod p_j for i < j
+    std::vector<std::vector<uint32_t>> inv(k, std::vector<uint32_t>(k));
+    for (unsigned j = 0; j < k; j++) {
+        MontgomeryField F(primes[j].p);
+        for (unsigned i = 0; i < j; i++)
+            inv[i][j] = F.from(F.pow(F.to(primes[i].p % primes[j].p),
+                                     primes[j].p - 2));
+    }
+    integer_class m(1), half;
+    for (unsigned i = 0; i < k; i++)
+        m *= primes[i].p;
+    half = m >> 1;
+
+    dense_poly r(len);
+    std::vector<uint64_t> digits(k);
+    for (size_t j = 0; j < len; j++) {
+        // The mixed radix digits, r = d_0 + d_1*p_0 + d_2*p_0*p_1 + ...
+        for (unsigned i = 0; i < k; i++) {
+            uint64_t p = primes[i].p, d = res[i][j];
+            for (unsigned l = 0; l < i; l++)
+                d = (d + p - digits[l] % p) * inv[l][i] % p;
+            digits[i] = d;
+        }
+        integer_class &c = r[j];
+        c = static_cast<unsigned long>(digits[k - 1]);
+        for (unsigned i = k - 1; i-- > 0;) {
+            c *= static_cast<unsigned long>(primes[i].p);
+            c += static_cast<unsigned long>(digits[i]);
+        }
+        if (c > half)
+            c -= m;
+    }
+    return r;
+}
+
+// The product by Kronecker substitution: both polynomials are evaluated at a
+// power of two large enough to separate the coefficients of the product,
+// which are read back from the product of the two integers.
+UIntDict mul_kronecker(const UIntDict &a, const UIntDict &b)
+{
+    int mul = 1;
+
+    unsigned int N = bit_length(std::min(a.degree() + 1, b.degree() + 1))
+                     + bit_length(a.max_abs_coef())
+                     + bit_length(b.max_abs_coef());
+
+    integer_class full = integer_class(1), temp, res;
+    full <<= N;
+    integer_class thresh = full / 2;
+    integer_class mask = full - 1;
+    integer_class s_val = a.eval_bit(N) * b.eval_bit(N);
+    if (s_val < 0)
+        mul = -1;
+    s_val = mp_abs(s_val);
+
+    unsigned int deg = 0, carry = 0;
+    UIntDict r;
+
+    while (s_val != 0 or carry != 0) {
+        mp_and(temp, s_val, mask);
+        if (temp < thresh) {
+            res = mul * (temp + carry);
+            if (res != 0)
+                r.dict_[deg] = res;
+            carry = 0;
+        } else {
+            res = mul * (temp - full + carry);
+            if (res != 0)
+                r.dict_[deg] = res;
+            carry = 1;
+        }
+        s_val >>= N;
+        deg++;
+    }
+    return r;
+}
+
+} // namespace
+
 UIntPoly::UIntPoly(const RCP<const Basic> &var, UIntDict &&dict)
     : USymEnginePoly(
         var, std::move(dict)){SYMENGINE_ASSIGN_TYPEID()
@@ -22,6 +446,125 @@ UIntPoly::UIntPoly(const RCP<const Basic> &var, UIntDict &&dict)
     return seed;
 }
 
+UIntDict UIntDict::mul(const UIntDict &a, const UIntDict &b)
+{
+    if (a.empty() or b.empty())
+        return UIntDict();
+    size_t pairs = a.size() * b.size();
+    size_t na = a.degree() + 1, nb = b.degree() + 1, len = na + nb - 1;
+    if (pairs <= mul_schoolbook_pairs or pairs < len)
+        return mul_schoolbook(a, b);
+
+    // The coefficients of the product are less than 2**bits in absolute
+    // value, and each prime of the transform is larger than 2**30
+    size_t n = std::min(na, nb);
+    unsigned bits = bit_length(n) + bit_length(a.max_abs_coef())
+                    + bit_length(b.max_abs_coef());
+    unsigned k = bits / 30 + 1;
+    bool ntt = k <= ntt_primes().size()
+               and len <= (size_t(1) << ntt_max_log);
+    if (n >= mul_ntt_threshold and ntt) {
+        dense_poly f = to_dense(a.dict_);
+        if (&a == &b) {
+            dense_poly r = mul_ntt(f, f, k);
+            return from_dense(r);
+        }
+        dense_poly r = mul_ntt(f, to_dense(b.dict_), k);
+        return from_dense(r);
+    }
+    if (n >= mul_karatsuba_threshold and not ntt) {
+        dense_poly f = to_dense(a.dict_), g = to_dense(b.dict_), r(len);
+        mul_karatsuba(f.data(), na, g.data(), nb, r.data());
+        return from_dense(r);
+    }
+    return mul_kronecker(a, b);
+}
+
+UIntDict UIntDict::gcd(const UIntDict &a, const UIntDict &b)
+{
+    if (a.empty() or b.empty()) {
+        UIntDict r = a.empty() ? b : a;
+        if (not r.empty() and r.get_lc() < 0)
+            r = -r;
+        return r;
+    }
+    dense_poly f = to_dense(a.dict_), g = to_dense(b.dict_);
+    integer_class cf = content(f), cg = content(g), c;
+    mp_gcd(c, cf, cg);
+    for (auto &x : f)
+        mp_divexact(x, x, cf);
+    for (auto &x : g)
+        mp_divexact(x, x, cg);
+    if (f.size() == 1 or g.size() == 1)
+        return UIntDict(c);
+
+    // The gcd of the primitive parts is computed modulo word sized primes
+    // and lifted by Chinese remaindering, until the result stops changing
+    // and divides both. Its leading coefficient divides `gamma`, so the
+    // modular images are normalized to that leading coefficient.
+    integer_class gamma;
+    mp_gcd(gamma, f.back(), g.back());
+
+    // One more than the number of coefficients of the gcd so far
+    size_t deg = std::min(f.size(), g.size()) + 1;
+    dense_poly h;
+    integer_class m, p(1), mprod, minv, t, half;
+    p <<= 62;
+    while (true) {
+        mp_nextprime(p, p);
+        mp_fdiv_r(t, gamma, p);
+        if (t == 0)
+            continue;
+        GaloisFieldDict hp = GaloisFieldDict::from_vec(f, p).gf_gcd(
+            GaloisFieldDict::from_vec(g, p));
+        if (hp.dict_.size() == 1)
+            return UIntDict(c);
+        if (hp.dict_.size() > deg)
+            continue; // unlucky prime
+        hp *= t;
+        if (hp.dict_.size() < deg) {
+            // All the previous primes were unlucky
+            deg = hp.dict_.size();
+            h = hp.dict_;
+            m = p;
+            half = m >> 1;
+            for (auto &x : h)
+                if (x > half)
+                    x -= m;
+            continue;
+        }
+        mp_invert(minv, m, p);
+        mprod = m * p;
+        half = mprod >> 1;
+        bool changed = false;
+        for (size_t i = 0; i < deg; i++) {
+            t = hp.dict_[i] - h[i];
+            t *= minv;
+            mp_fdiv_r(t, t, p);
+            if (t == 0)
+                continue;
+            changed = true;
+            mp_addmul(h[i], m, t);
+            if (h[i] > half)
+                h[i] -= mprod;
+        }
+        m = mprod;
+        if (changed)
+            continue;
+        dense_poly r = h;
+        integer_class cr = content(r);
+        for (auto &x : r)
+            mp_divexact(x, x, cr);
+        if (divides_dense(r, f) and divides_dense(r, g)) {
+            UIntDict res;
+            for (unsigned i = 0; i < r.size(); i++)
+                if (r[i] != 0)
+                    res.dict_[i] = c * r[i];
+            return res;
+        }
+    }
+}
+
 bool divides_upoly(const UIntPoly &a, const UIntPoly &b,
                    const Ptr<RCP<const UIntPoly>> &out)
 {
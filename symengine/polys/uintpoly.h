@@ -54,44 +54,14 @@ public:
         return result;
     }
 
-    static UIntDict mul(const UIntDict &a, const UIntDict &b)
-    {
-        int mul = 1;
-
-        unsigned int N = bit_length(std::min(a.degree() + 1, b.degree() + 1))
-                         + bit_length(a.max_abs_coef())
-                         + bit_length(b.max_abs_coef());
-
-        integer_class full = integer_class(1), temp, res;
-        full <<= N;
-        integer_class thresh = full / 2;
-        integer_class mask = full - 1;
-        integer_class s_val = a.eval_bit(N) * b.eval_bit(N);
-        if (s_val < 0)
-            mul = -1;
-        s_val = mp_abs(s_val);
-
-        unsigned int deg = 0, carry = 0;
-        UIntDict r;
-
-        while (s_val != 0 or carry != 0) {
-            mp_and(temp, s_val, mask);
-            if (temp < thresh) {
-                res = mul * (temp + carry);
-                if (res != 0)
-                    r.dict_[deg] = res;
-                carry = 0;
-            } else {
-                res = mul * (temp - full + carry);
-                if (res != 0)
-                    r.dict_[deg] = res;
-                carry = 1;
-            }
-            s_val >>= N;
-            deg++;
-        }
-        return r;
-    }
+    //! Multiplies term by term for small or sparse products, and for dense
+    //! ones by Kronecker substitution, Karatsuba or a number theoretic
+    //! transform modulo word sized primes, depending on the size.
+    static UIntDict mul(const UIntDict &a, const UIntDict &b);
+
+    //! \return the greatest common divisor of `a` and `b`, with a positive
+    //! leading coefficient. Computed by a multi-modular algorithm.
+    static UIntDict gcd(const UIntDict &a, const UIntDict &b);
 
     int compare(const UIntDict &other) const
     {
@@ -1,4 +1,5 @@
 #include <symengine/polys/uratpoly.h>
+#include <symengine/polys/uintpoly.h>
 
 namespace SymEngine
 {
@@ -23,6 +24,38 @@ URatPoly::URatPoly(const RCP<const Basic> &var, URatDict &&dict)
     return seed;
 }
 
+namespace
+{
+
+// Clears the denominators of `a`
+UIntDict to_integer_dict(const URatDict &a)
+{
+    integer_class l(1);
+    for (const auto &p : a.dict_)
+        mp_lcm(l, l, get_den(p.second));
+    map_uint_mpz d;
+    integer_class t;
+    for (const auto &p : a.dict_) {
+        mp_divexact(t, l, get_den(p.second));
+        d[p.first] = get_num(p.second) * t;
+    }
+    return UIntDict(d);
+}
+
+} // namespace
+
+URatDict URatDict::gcd(const URatDict &a, const URatDict &b)
+{
+    UIntDict g = UIntDict::gcd(to_integer_dict(a), to_integer_dict(b));
+    if (g.empty())
+        return URatDict();
+    rational_class lc(g.get_lc());
+    map_uint_mpq d;
+    for (const auto &p : g.dict_)
+        d[p.first] = rational_class(p.second) / lc;
+    return URatDict(d);
+}
+
 bool divides_upoly(const URatPoly &a, const URatPoly &b,
                    const Ptr<RCP<const URatPoly>> &out)
 {
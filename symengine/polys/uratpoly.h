@@ -27,6 +27,9 @@ public:
     URatDict(const URatDict &) = default;
     URatDict &operator=(const URatDict &) = default;
 
+    //! \return the monic greatest common divisor of `a` and `b`
+    static URatDict gcd(const URatDict &a, const URatDict &b);
+
     int compare(const URatDict &other) const
     {
         if (dict_.size() != other.dict_.size())
@@ -125,6 +125,17 @@ RCP<const Poly> pow_upoly(const USymEnginePoly<Container, BaseType, Poly> &a,
     auto dict = Poly::container_type::pow(a.get_poly(), p);
     return Poly::from_container(a.get_var(), std::move(dict));
 }
+
+template <typename Container, template <typename X, typename Y> class BaseType,
+          typename Poly>
+RCP<const Poly> gcd_upoly(const USymEnginePoly<Container, BaseType, Poly> &a,
+                          const Poly &b)
+{
+    if (!(a.get_var()->__eq__(*b.get_var())))
+        throw SymEngineException("Error: variables must agree.");
+    auto dict = Poly::container_type::gcd(a.get_poly(), b.get_poly());
+    return Poly::from_container(a.get_var(), std::move(dict));
+}
 } // namespace SymEngine
 
 #endif
@@ -0,0 +1,378 @@
+#include <symengine/pool_allocator.h>
+#include <symengine/symengine_assert.h>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <new>
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+#include <atomic>
+#include <mutex>
+#endif
+
+namespace SymEngine
+{
+
+namespace
+{
+
+// Size of the slabs that refill the free lists
+const std::size_t pool_slab_size = 64 * 1024;
+// Size of the chunks of a PoolArena
+const std::size_t arena_chunk_size = 256 * 1024;
+
+struct FreeBlock {
+    FreeBlock *next;
+};
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+// The per-thread counters are only written by their owning thread, so a
+// relaxed load and store is enough (no locked read-modify-write), but they
+// are read by pool_allocator_stats() from other threads.
+typedef std::atomic<std::size_t> pool_counter;
+
+inline void counter_add(pool_counter &c, std::size_t n)
+{
+    c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+#else
+typedef std::size_t pool_counter;
+
+inline void counter_add(pool_counter &c, std::size_t n)
+{
+    c += n;
+}
+#endif
+
+inline unsigned size_class(std::size_t size)
+{
+    return size == 0 ? 0
+                     : static_cast<unsigned>((size - 1) / pool_granularity);
+}
+
+inline std::size_t block_size(unsigned c)
+{
+    return (c + 1) * pool_granularity;
+}
+
+class ThreadCache;
+
+// Global state shared by all threads: the free lists given back by exited
+// threads, their counters and the registry of the live thread caches.
+struct PoolDepot {
+    FreeBlock *free[pool_size_classes];
+    std::size_t free_count[pool_size_classes];
+    std::size_t allocated[pool_size_classes];
+    std::size_t released[pool_size_classes];
+    std::vector<ThreadCache *> caches;
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+    std::mutex mutex;
+#endif
+
+    PoolDepot()
+    {
+        std::fill(free, free + pool_size_classes, nullptr);
+        std::fill(free_count, free_count + pool_size_classes, 0);
+        std::fill(allocated, allocated + pool_size_classes, 0);
+        std::fill(released, released + pool_size_classes, 0);
+    }
+
+    // Returns a free list of class `c` and stores its length into `n`: the
+    // blocks given back by exited threads, or else a freshly carved slab.
+    // The caller must hold the lock.
+    FreeBlock *take(unsigned c, std::size_t &n)
+    {
+        FreeBlock *head = free[c];
+        if (head != nullptr) {
+            n = free_count[c];
+            free[c] = nullptr;
+            free_count[c] = 0;
+            return head;
+        }
+        std::size_t size = block_size(c);
+        char *slab = static_cast<char *>(::operator new(pool_slab_size));
+        n = pool_slab_size / size;
+        for (std::size_t i = 0; i < n; i++) {
+            FreeBlock *b = reinterpret_cast<FreeBlock *>(slab + i * size);
+            b->next = (i + 1 < n)
+                          ? reinterpret_cast<FreeBlock *>(slab + (i + 1) * size)
+                          : nullptr;
+        }
+        return reinterpret_cast<FreeBlock *>(slab);
+    }
+};
+
+// The depot is never destroyed, so that objects released during static
+// destruction can still be returned to the pool.
+PoolDepot &get_depot()
+{
+    static PoolDepot *depot = new PoolDepot();
+    return *depot;
+}
+
+class ThreadCache
+{
+public:
+    FreeBlock *free_[pool_size_classes];
+    pool_counter free_count_[pool_size_classes];
+    pool_counter allocated_[pool_size_classes];
+    pool_counter released_[pool_size_classes];
+
+    ThreadCache()
+    {
+        for (unsigned c = 0; c < pool_size_classes; c++) {
+            free_[c] = nullptr;
+            free_count_[c] = 0;
+            allocated_[c] = 0;
+            released_[c] = 0;
+        }
+        PoolDepot &depot = get_depot();
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+        std::lock_guard<std::mutex> lock(depot.mutex);
+#endif
+        depot.caches.push_back(this);
+    }
+
+    inline void *allocate(unsigned c)
+    {
+        FreeBlock *b = free_[c];
+        if (b == nullptr) {
+            b = refill(c);
+        }
+        free_[c] = b->next;
+        counter_add(free_count_[c], std::size_t(-1));
+        counter_add(allocated_[c], 1);
+        return b;
+    }
+
+    inline void deallocate(void *p, unsigned c)
+    {
+        FreeBlock *b = static_cast<FreeBlock *>(p);
+        b->next = free_[c];
+        free_[c] = b;
+        counter_add(free_count_[c], 1);
+        counter_add(released_[c], 1);
+    }
+
+    // Hands the free lists and the counters over to the depot
+    void retire()
+    {
+        PoolDepot &depot = get_depot();
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+        std::lock_guard<std::mutex> lock(depot.mutex);
+#endif
+        for (unsigned c = 0; c < pool_size_classes; c++) {
+            while (free_[c] != nullptr) {
+                FreeBlock *b = free_[c];
+                free_[c] = b->next;
+                b->next = depot.free[c];
+                depot.free[c] = b;
+            }
+            depot.free_count[c] += free_count_[c];
+            depot.allocated[c] += allocated_[c];
+            depot.released[c] += released_[c];
+        }
+        depot.caches.erase(
+            std::find(depot.caches.begin(), depot.caches.end(), this));
+    }
+
+private:
+    FreeBlock *refill(unsigned c)
+    {
+        PoolDepot &depot = get_depot();
+        std::size_t n;
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+        std::lock_guard<std::mutex> lock(depot.mutex);
+#endif
+        free_[c] = depot.take(c, n);
+        counter_add(free_count_[c], n);
+        return free_[c];
+    }
+};
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+
+thread_local PoolArena *current_arena = nullptr;
+thread_local ThreadCache *current_cache = nullptr;
+thread_local bool cache_retired = false;
+
+// The cache itself is held by a plain pointer, so that it is still usable
+// while other thread local objects are destroyed. This guard retires it at
+// thread exit, any later requests of this thread go to the depot directly.
+struct ThreadCacheGuard {
+    ~ThreadCacheGuard()
+    {
+        if (current_cache != nullptr) {
+            current_cache->retire();
+            delete current_cache;
+            current_cache = nullptr;
+        }
+        cache_retired = true;
+    }
+};
+
+thread_local ThreadCacheGuard cache_guard;
+
+inline ThreadCache *get_cache()
+{
+    if (current_cache == nullptr and not cache_retired) {
+        // Taking the address constructs the guard in this thread
+        (void)&cache_guard;
+        current_cache = new ThreadCache();
+    }
+    return current_cache;
+}
+
+#else
+
+PoolArena *current_arena = nullptr;
+
+inline ThreadCache *get_cache()
+{
+    static ThreadCache *cache = new ThreadCache();
+    return cache;
+}
+
+#endif
+
+void *depot_allocate(unsigned c)
+{
+    PoolDepot &depot = get_depot();
+    std::size_t n;
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+    std::lock_guard<std::mutex> lock(depot.mutex);
+#endif
+    FreeBlock *b = depot.take(c, n);
+    depot.free[c] = b->next;
+    depot.free_count[c] = n - 1;
+    depot.allocated[c]++;
+    return b;
+}
+
+void depot_deallocate(void *p, unsigned c)
+{
+    PoolDepot &depot = get_depot();
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+    std::lock_guard<std::mutex> lock(depot.mutex);
+#endif
+    FreeBlock *b = static_cast<FreeBlock *>(p);
+    b->next = depot.free[c];
+    depot.free[c] = b;
+    depot.free_count[c]++;
+    depot.released[c]++;
+}
+
+} // namespace
+
+void *pool_allocate(std::size_t size)
+{
+    if (size > pool_max_size) {
+        return ::operator new(size);
+    }
+    if (current_arena != nullptr) {
+        return current_arena->allocate(size);
+    }
+    unsigned c = size_class(size);
+    ThreadCache *cache = get_cache();
+    if (cache == nullptr) {
+        return depot_allocate(c);
+    }
+    return cache->allocate(c);
+}
+
+void pool_deallocate(void *p, std::size_t size)
+{
+    if (p == nullptr) {
+        return;
+    }
+    if (size > pool_max_size) {
+        ::operator delete(p);
+        return;
+    }
+    for (PoolArena *a = current_arena; a != nullptr; a = a->outer_) {
+        if (a->owns(p)) {
+            // The memory is released together with the arena
+            a->live_--;
+            return;
+        }
+    }
+    unsigned c = size_class(size);
+    ThreadCache *cache = get_cache();
+    if (cache == nullptr) {
+        depot_deallocate(p, c);
+        return;
+    }
+    cache->deallocate(p, c);
+}
+
+std::vector<PoolSizeClassStats> pool_allocator_stats()
+{
+    PoolDepot &depot = get_depot();
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+    std::lock_guard<std::mutex> lock(depot.mutex);
+#endif
+    std::vector<PoolSizeClassStats> stats(pool_size_classes);
+    for (unsigned c = 0; c < pool_size_classes; c++) {
+        std::size_t allocated = depot.allocated[c];
+        std::size_t released = depot.released[c];
+        std::size_t free = depot.free_count[c];
+        for (const ThreadCache *cache : depot.caches) {
+            allocated += cache->allocated_[c];
+            released += cache->released_[c];
+            free += cache->free_count_[c];
+        }
+        stats[c].block_size = block_size(c);
+        stats[c].live = allocated - released;
+        stats[c].free = free;
+    }
+    return stats;
+}
+
+PoolArena::PoolArena()
+    : current_(nullptr), end_(nullptr), bytes_(0), live_(0),
+      outer_(current_arena)
+{
+    current_arena = this;
+}
+
+PoolArena::~PoolArena()
+{
+    SYMENGINE_ASSERT(current_arena == this)
+    SYMENGINE_ASSERT_MSG(live_ == 0,
+                         "PoolArena destroyed while objects allocated in it "
+                         "are still alive")
+    current_arena = outer_;
+    for (char *chunk : chunks_) {
+        ::operator delete(chunk);
+    }
+}
+
+void *PoolArena::allocate(std::size_t size)
+{
+    std::size_t n = block_size(size_class(size));
+    if (current_ == nullptr or n > std::size_t(end_ - current_)) {
+        current_ = static_cast<char *>(::operator new(arena_chunk_size));
+        end_ = current_ + arena_chunk_size;
+        chunks_.push_back(current_);
+    }
+    void *p = current_;
+    current_ += n;
+    bytes_ += n;
+    live_++;
+    return p;
+}
+
+bool PoolArena::owns(const void *p) const
+{
+    const char *q = static_cast<const char *>(p);
+    std::less<const char *> less;
+    for (const char *chunk : chunks_) {
+        if (not less(q, chunk) and less(q, chunk + arena_chunk_size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace SymEngine
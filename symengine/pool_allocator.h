@@ -0,0 +1,114 @@
+/**
+ *  \file pool_allocator.h
+ *  Size-class pool allocator for RCP managed objects
+ *
+ *  When SymEngine is configured with `WITH_SYMENGINE_POOL_ALLOCATOR=yes`,
+ *  `EnableRCPFromThis` overloads `operator new` and `operator delete`, so
+ *  every object created by `make_rcp()` and released by `RCP` is allocated
+ *  from the pool declared here instead of the general purpose heap.
+ *
+ *  Requests are rounded up to a multiple of `pool_granularity` bytes and
+ *  served from per size class free lists that are refilled from large slabs.
+ *  With `WITH_SYMENGINE_THREAD_SAFE` every thread has its own free lists, so
+ *  no locking is needed on the fast path. The free lists of a thread that
+ *  exits are handed over to a global depot. Slabs are never returned to the
+ *  operating system. Requests larger than `pool_max_size` are forwarded to
+ *  the global `operator new`.
+ *
+ *  The functions are also available without the build option, so they can
+ *  be used (and tested) directly.
+ **/
+
+#ifndef SYMENGINE_POOL_ALLOCATOR_H
+#define SYMENGINE_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <vector>
+#include <symengine/symengine_config.h>
+
+namespace SymEngine
+{
+
+//! Size classes are multiples of this many bytes
+const std::size_t pool_granularity = 16;
+//! Larger requests are not pooled
+const std::size_t pool_max_size = 256;
+//! Number of size classes
+const unsigned pool_size_classes = pool_max_size / pool_granularity;
+
+//! Allocates `size` bytes from the pool (or the active `PoolArena`)
+void *pool_allocate(std::size_t size);
+//! Returns `p`, allocated by `pool_allocate(size)`, to the pool
+void pool_deallocate(void *p, std::size_t size);
+
+//! Counters of one size class, summed over all threads
+struct PoolSizeClassStats {
+    //! Size of the blocks of this class in bytes
+    std::size_t block_size;
+    //! Number of blocks currently in use (allocated and not released yet)
+    std::size_t live;
+    //! Number of released blocks held in free lists for reuse
+    std::size_t free;
+};
+
+//! \return counters for every size class, ordered by block size
+std::vector<PoolSizeClassStats> pool_allocator_stats();
+
+/**
+ *  Scoped arena
+ *
+ *  While a `PoolArena` exists, all pooled allocations made by the thread
+ *  that created it are carved from the arena's chunks by bumping a pointer,
+ *  and releasing such objects does not make the memory available for reuse.
+ *  All the memory is given back at once when the arena is destroyed. This is
+ *  meant for computations that create many short-lived temporaries:
+ *
+ *      RCP<const Basic> r;
+ *      {
+ *          PoolArena arena;
+ *          // ... create and drop temporaries ...
+ *      }
+ *
+ *  Every object allocated in the arena must be destroyed before the arena
+ *  (results that outlive it must be created outside of it) and it must not
+ *  be released by another thread. Arenas can be nested, the innermost one is
+ *  active.
+ */
+class PoolArena
+{
+public:
+    PoolArena();
+    ~PoolArena();
+
+    PoolArena(const PoolArena &) = delete;
+    PoolArena &operator=(const PoolArena &) = delete;
+
+    //! \return the number of bytes handed out from this arena so far
+    std::size_t bytes_allocated() const
+    {
+        return bytes_;
+    }
+    //! \return the number of objects allocated in the arena and still alive
+    std::size_t live() const
+    {
+        return live_;
+    }
+
+private:
+    void *allocate(std::size_t size);
+    bool owns(const void *p) const;
+
+    std::vector<char *> chunks_;
+    char *current_;
+    char *end_;
+    std::size_t bytes_;
+    std::size_t live_;
+    PoolArena *outer_;
+
+    friend void *pool_allocate(std::size_t size);
+    friend void pool_deallocate(void *p, std::size_t size);
+};
+
+} // namespace SymEngine
+
+#endif
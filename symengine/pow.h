@@ -45,6 +45,11 @@ public:
     }
 
     vec_basic get_args() const override;
+    void for_each_arg(const arg_callback &f) const override
+    {
+        f(base_);
+        f(exp_);
+    }
 };
 
 //! \return Pow from `a` and `b`
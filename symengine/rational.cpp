@@ -1,10 +1,88 @@
 #include <symengine/rational.h>
 #include <symengine/pow.h>
+#include <symengine/intern.h>
 #include <symengine/symengine_exception.h>
 
 namespace SymEngine
 {
 
+namespace
+{
+
+// Rationals p/q with |p| <= rational_cache_max and
+// 2 <= q <= rational_cache_max are preallocated
+const long rational_cache_max = 16;
+// sqrt(n) and 1/sqrt(n) are preallocated for square-free
+// 2 <= n <= sqrt_cache_max
+const long sqrt_cache_max = 64;
+
+// The tables are never destroyed, see integer_cache(). Entries that are not
+// in canonical form (or not square-free) are null.
+const RCP<const Rational> *rational_cache()
+{
+    static const RCP<const Rational> *cache = [] {
+        const long n = 2 * rational_cache_max + 1;
+        RCP<const Rational> *table
+            = new RCP<const Rational>[(rational_cache_max - 1) * n];
+        for (long q = 2; q <= rational_cache_max; q++) {
+            for (long p = -rational_cache_max; p <= rational_cache_max; p++) {
+                integer_class num(p), den(q);
+                rational_class r(num, den);
+                canonicalize(r);
+                if (SymEngine::get_den(r) == den)
+                    table[(q - 2) * n + p + rational_cache_max]
+                        = make_rcp<const Rational>(std::move(r));
+            }
+        }
+        return table;
+    }();
+    return cache;
+}
+
+RCP<const Rational> cached_rational(const rational_class &i)
+{
+    long p, q;
+    if (mp_get_si_if_fits(SymEngine::get_num(i), p)
+        and mp_get_si_if_fits(SymEngine::get_den(i), q) and q >= 2
+        and q <= rational_cache_max and p >= -rational_cache_max
+        and p <= rational_cache_max)
+        return rational_cache()[(q - 2) * (2 * rational_cache_max + 1) + p
+                                + rational_cache_max];
+    return null;
+}
+
+bool is_square_free(long n)
+{
+    for (long p = 2; p * p <= n; p++) {
+        if (n % (p * p) == 0)
+            return false;
+    }
+    return true;
+}
+
+// Entries 2 * n and 2 * n + 1 hold n**(1/2) and n**(-1/2)
+const RCP<const Basic> *sqrt_cache()
+{
+    static const RCP<const Basic> *cache = [] {
+        RCP<const Basic> *table = new RCP<const Basic>[2 * sqrt_cache_max + 2];
+        RCP<const Number> half = Rational::from_two_ints(1, 2);
+        for (long n = 2; n <= sqrt_cache_max; n++) {
+            if (not is_square_free(n))
+                continue;
+            // These are the nodes built by Rational::rpowrat()
+            table[2 * n] = make_rcp<const Pow>(integer(n), half);
+            fmap_basic_basic d;
+            insert(d, integer(n), half);
+            table[2 * n + 1]
+                = Mul::from_dict(Rational::from_two_ints(1, n), std::move(d));
+        }
+        return table;
+    }();
+    return cache;
+}
+
+} // namespace
+
 bool Rational::is_canonical(const rational_class &i) const
 {
     rational_class x = i;
@@ -26,6 +104,9 @@ RCP<const Number> Rational::from_mpq(const rational_class &i)
     if (SymEngine::get_den(i) == 1) {
         return integer(SymEngine::get_num(i));
     } else {
+        RCP<const Rational> r = cached_rational(i);
+        if (not r.is_null())
+            return r;
         rational_class j(i);
         return make_rcp<const Rational>(std::move(j));
     }
@@ -37,6 +118,9 @@ RCP<const Number> Rational::from_mpq(rational_class &&i)
     if (SymEngine::get_den(i) == 1) {
         return integer(SymEngine::get_num(i));
     } else {
+        RCP<const Rational> r = cached_rational(i);
+        if (not r.is_null())
+            return r;
         return make_rcp<const Rational>(std::move(i));
     }
 }
@@ -197,6 +281,16 @@ RCP<const Basic> Rational::rpowrat(const Integer &other) const
     if (other.is_one()) {
         return one;
     }
+    if (SymEngine::get_den(i) == 2u and mp_abs(SymEngine::get_num(i)) == 1u
+        and other.as_integer_class() >= 2u
+        and other.as_integer_class() <= sqrt_cache_max) {
+        // sqrt(n) and 1/sqrt(n) for small n are shared nodes
+        long n = mp_get_si(other.as_integer_class());
+        const RCP<const Basic> &r
+            = sqrt_cache()[2 * n + (SymEngine::get_num(i) < 0u)];
+        if (not r.is_null())
+            return intern(r);
+    }
     RCP<const Integer> res;
     if (mp_fits_ulong_p(SymEngine::get_den(i))) {
         unsigned long den = mp_get_ui(SymEngine::get_den(i));
@@ -222,7 +316,7 @@ RCP<const Basic> Rational::rpowrat(const Integer &other) const
     // 0 and 1. We multiply numerator and denominator appropriately
     // to achieve this
     RCP<const Number> coef = other.powint(*integer(q));
-    map_basic_basic surd;
+    fmap_basic_basic surd;
 
     if ((other.is_negative()) and den == 2) {
         imulnum(outArg(coef), I);
@@ -4,6 +4,13 @@
 #include <symengine/monomials.h>
 #include <symengine/symengine_exception.h>
 
+#include <algorithm>
+#include <cstdint>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace SymEngine
 {
 
@@ -20,7 +27,7 @@ void expr2poly(const RCP<const Basic> &p, umap_basic_num &syms, umap_vec_mpz &P)
             coef = down_cast<const Integer &>(*p.second).as_integer_class();
             exp.assign(n, 0); // Initialize to [0]*n
             if (is_a<Mul>(*p.first)) {
-                const map_basic_basic &term
+                const fmap_basic_basic &term
                     = down_cast<const Mul &>(*p.first).get_dict();
                 for (const auto &q : term) {
                     RCP<const Basic> sym = q.first;
@@ -68,40 +75,133 @@ void expr2poly(const RCP<const Basic> &p, umap_basic_num &syms, umap_vec_mpz &P)
     }
 }
 
-void poly_mul(const umap_vec_mpz &A, const umap_vec_mpz &B, umap_vec_mpz &C)
+namespace
+{
+
+// Products with fewer term pairs than this are computed by a single thread
+const std::size_t poly_mul_parallel_threshold = 1 << 16;
+
+// Terms with the exponents packed into a word, and a polynomial keyed by
+// the packed exponents
+typedef std::vector<std::pair<uint64_t, const integer_class *>> packed_terms;
+typedef FlatHashMap<uint64_t, integer_class> packed_poly;
+
+// Maps `e` to one of `parts` partitions, spread by Fibonacci hashing
+inline unsigned partition(uint64_t e, unsigned parts)
+{
+    uint64_t h = (e * UINT64_C(0x9E3779B97F4A7C15)) >> 32;
+    return static_cast<unsigned>((h * parts) >> 32);
+}
+
+// Adds the terms of `A*B` whose monomials fall into the partition `part`
+// out of `parts` to `C`
+void packed_mul(const packed_terms &A, const packed_terms &B, unsigned part,
+                unsigned parts, packed_poly &C)
 {
-    vec_int exp;
-    auto n = A.begin()->first.size();
-    exp.assign(n, 0); // Initialize to [0]*n
-    /*
-    std::cout << "A: " << A.load_factor() << " " << A.bucket_count() << " " <<
-    A.size() << " "
-        << A.max_bucket_count() << std::endl;
-    std::cout << "B: " << B.load_factor() << " " << B.bucket_count() << " " <<
-    B.size() << " "
-        << B.max_bucket_count() << std::endl;
-    std::cout << "C: " << C.load_factor() << " " << C.bucket_count() << " " <<
-    C.size() << " "
-        << C.max_bucket_count() << std::endl;
-        */
     for (const auto &a : A) {
         for (const auto &b : B) {
-            monomial_mul(a.first, b.first, exp);
-            mp_addmul(C[exp], a.second, b.second);
+            uint64_t e = a.first + b.first;
+            if (parts > 1 and partition(e, parts) != part)
+                continue;
+            mp_addmul(C[e], *a.second, *b.second);
         }
     }
-    /*
-    std::cout << "C: " << C.load_factor() << " " << C.bucket_count() << " " <<
-    C.size() << " "
-        << C.max_bucket_count() << std::endl;
-    for (const std::size_t n=0; n < C.bucket_count(); n++) {
-        std::cout << n << ": " << C.bucket_size(n) << "|";
-        for (auto it = C.begin(n); it != C.end(n); ++it)
-            std::cout << " " << it->first << myhash2(it->first) %
-    C.bucket_count();
-        std::cout << std::endl;
+}
+
+} // namespace
+
+void poly_mul(const umap_vec_mpz &A, const umap_vec_mpz &B, umap_vec_mpz &C,
+              unsigned num_threads)
+{
+    if (A.empty() or B.empty())
+        return;
+    auto n = A.begin()->first.size();
+
+    // The exponents are packed into a single word, with a field wide enough
+    // for the degree of the product in each variable. Negative exponents,
+    // or exponents that do not fit, take the generic path.
+    vec_int da(n, 0), db(n, 0);
+    bool packed = true;
+    for (const auto &a : A)
+        for (unsigned i = 0; i < n; i++) {
+            packed = packed and a.first[i] >= 0;
+            da[i] = std::max(da[i], a.first[i]);
+        }
+    for (const auto &b : B)
+        for (unsigned i = 0; i < n; i++) {
+            packed = packed and b.first[i] >= 0;
+            db[i] = std::max(db[i], b.first[i]);
+        }
+    std::vector<unsigned> shift(n);
+    std::vector<uint64_t> mask(n);
+    unsigned bits = 0;
+    for (unsigned i = 0; i < n and packed; i++) {
+        uint64_t d = uint64_t(da[i]) + uint64_t(db[i]);
+        unsigned w = 0;
+        while (d >> w != 0)
+            w++;
+        shift[i] = bits;
+        mask[i] = (uint64_t(1) << w) - 1;
+        bits += w;
+        packed = bits <= 64;
+    }
+
+    if (not packed) {
+        vec_int exp(n, 0);
+        for (const auto &a : A) {
+            for (const auto &b : B) {
+                monomial_mul(a.first, b.first, exp);
+                mp_addmul(C[exp], a.second, b.second);
+            }
+        }
+        return;
+    }
+
+    packed_terms pa, pb;
+    pa.reserve(A.size());
+    pb.reserve(B.size());
+    for (const auto &a : A) {
+        uint64_t e = 0;
+        for (unsigned i = 0; i < n; i++)
+            e |= uint64_t(a.first[i]) << shift[i];
+        pa.push_back({e, &a.second});
+    }
+    for (const auto &b : B) {
+        uint64_t e = 0;
+        for (unsigned i = 0; i < n; i++)
+            e |= uint64_t(b.first[i]) << shift[i];
+        pb.push_back({e, &b.second});
+    }
+
+    // Every thread computes the terms of the product in its own partition
+    // of the monomials, so the threads never write to the same coefficient
+    // and need no synchronization. Small products are not worth the threads.
+    unsigned parts = 1;
+#ifdef _OPENMP
+    parts = num_threads == 0 ? static_cast<unsigned>(omp_get_max_threads())
+                             : num_threads;
+#endif
+    if (A.size() * B.size() < poly_mul_parallel_threshold)
+        parts = 1;
+    std::vector<packed_poly> CP(parts);
+#pragma omp parallel for schedule(static, 1) num_threads(parts)
+    for (unsigned p = 0; p < parts; p++) {
+        CP[p].reserve(std::max(A.size(), B.size()) / parts);
+        packed_mul(pa, pb, p, parts, CP[p]);
+    }
+
+    std::size_t size = C.size();
+    for (const auto &cp : CP)
+        size += cp.size();
+    C.reserve(size);
+    vec_int exp(n);
+    for (auto &cp : CP) {
+        for (auto &t : cp) {
+            for (unsigned i = 0; i < n; i++)
+                exp[i] = static_cast<int>((t.first >> shift[i]) & mask[i]);
+            C[exp] += t.second;
+        }
     }
-    */
 }
 
 } // namespace SymEngine
@@ -16,7 +16,14 @@ void expr2poly(const RCP<const Basic> &p, umap_basic_num &syms,
                umap_vec_mpz &P);
 
 //! Multiply two polynomials: `C = A*B`
-void poly_mul(const umap_vec_mpz &A, const umap_vec_mpz &B, umap_vec_mpz &C);
+/*!
+ *  When the exponents of the product fit into a 64 bit word, the terms are
+ *  multiplied on packed exponents. With OpenMP, large products are split
+ *  among `num_threads` threads (by default the OpenMP maximum), each of
+ *  which computes the terms in its own hash partition of the monomials.
+ */
+void poly_mul(const umap_vec_mpz &A, const umap_vec_mpz &B, umap_vec_mpz &C,
+              unsigned num_threads = 0);
 
 } // namespace SymEngine
 
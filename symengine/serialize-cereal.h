@@ -452,7 +452,7 @@ template <class Archive>
 RCP<const Basic> load_basic(Archive &ar, RCP<const Mul> &)
 {
     RCP<const Number> coeff;
-    map_basic_basic dict;
+    fmap_basic_basic dict;
     ar(coeff);
     ar(dict);
     return make_rcp<const Mul>(coeff, std::move(dict));
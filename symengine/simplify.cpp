@@ -42,7 +42,7 @@ SimplifyVisitor::simplify_pow(const RCP<const Basic> &e,
 
 void SimplifyVisitor::bvisit(const Mul &x)
 {
-    map_basic_basic map;
+    fmap_basic_basic map;
     for (const auto &p : x.get_dict()) {
         auto base = apply(p.first);
         auto newpair = simplify_pow(p.second, base);
@@ -80,7 +80,7 @@ public:
     void bvisit(const Mul &x)
     {
         RCP<const Number> coef = one;
-        map_basic_basic d;
+        fmap_basic_basic d;
         for (const auto &p : x.get_dict()) {
             RCP<const Basic> factor_old;
             if (eq(*p.second, *one)) {
@@ -7,6 +7,7 @@
 #define SYMENGINE_SYMBOL_H
 
 #include <symengine/basic.h>
+#include <symengine/intern.h>
 
 namespace SymEngine
 {
@@ -44,6 +45,7 @@ public:
     {
         return {};
     }
+    void for_each_arg(const arg_callback &f) const override {}
     RCP<const Symbol> as_dummy() const;
 };
 
@@ -86,7 +88,7 @@ public:
 //! inline version to return `Symbol`
 inline RCP<const Symbol> symbol(const std::string &name)
 {
-    return make_rcp<const Symbol>(name);
+    return intern(make_rcp<const Symbol>(name));
 }
 
 //! inline version to return `Dummy`
@@ -4,6 +4,13 @@
 #include <symengine/utilities/teuchos/Teuchos_RCP.hpp>
 #endif
 
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#endif
+
 namespace SymEngine
 {
 
@@ -18,4 +25,123 @@ void print_stack_on_segfault()
 
 #endif
 
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+
+thread_local rcp_thread_id rcp_current_thread = rcp_no_thread;
+thread_local std::atomic<bool> rcp_queue_pending(false);
+
+namespace
+{
+
+typedef std::vector<std::pair<const void *, void (*)(const void *)>>
+    merge_queue;
+
+struct RCPThread {
+    std::atomic<bool> *pending;
+    merge_queue queue;
+};
+
+// The live threads by id. Ids are never reused, so an object owned by an
+// exited thread is never mistaken for an object of a newer thread.
+struct RCPThreadRegistry {
+    std::mutex mutex;
+    std::unordered_map<rcp_thread_id, RCPThread> threads;
+    rcp_thread_id next_id = 1;
+};
+
+// The registry is never destroyed, so that objects released during static
+// destruction can still be merged.
+RCPThreadRegistry &get_registry()
+{
+    static RCPThreadRegistry *registry = new RCPThreadRegistry();
+    return *registry;
+}
+
+void merge_all(const merge_queue &queue)
+{
+    for (const auto &p : queue) {
+        p.second(p.first);
+    }
+}
+
+thread_local bool thread_retired = false;
+
+// Unregisters the thread at exit. The objects it owns keep their counts,
+// later releases queue them and find no owner, so they are merged by the
+// releasing thread.
+struct RCPThreadGuard {
+    ~RCPThreadGuard()
+    {
+        RCPThreadRegistry &registry = get_registry();
+        merge_queue queue;
+        {
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            // From now on this thread uses the shared counts only
+            auto it = registry.threads.find(rcp_current_thread);
+            rcp_current_thread = rcp_no_thread;
+            thread_retired = true;
+            queue.swap(it->second.queue);
+            registry.threads.erase(it);
+        }
+        merge_all(queue);
+    }
+};
+
+thread_local RCPThreadGuard thread_guard;
+
+} // namespace
+
+rcp_thread_id rcp_register_thread()
+{
+    if (thread_retired) {
+        return rcp_no_owner;
+    }
+    // Taking the address constructs the guard in this thread
+    (void)&thread_guard;
+    RCPThreadRegistry &registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    rcp_thread_id id = registry.next_id++;
+    registry.threads[id].pending = &rcp_queue_pending;
+    rcp_current_thread = id;
+    return id;
+}
+
+void rcp_queue_merge(rcp_thread_id owner, const void *p,
+                     void (*merge)(const void *))
+{
+    RCPThreadRegistry &registry = get_registry();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto it = registry.threads.find(owner);
+        if (it != registry.threads.end()) {
+            it->second.queue.push_back(std::make_pair(p, merge));
+            it->second.pending->store(true, std::memory_order_relaxed);
+            return;
+        }
+    }
+    // The owner exited, its count cannot change anymore
+    merge(p);
+}
+
+void rcp_merge_queued()
+{
+    if (rcp_current_thread == rcp_no_thread) {
+        return;
+    }
+    RCPThreadRegistry &registry = get_registry();
+    merge_queue queue;
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        queue.swap(registry.threads[rcp_current_thread].queue);
+        rcp_queue_pending.store(false, std::memory_order_relaxed);
+    }
+    merge_all(queue);
+}
+
+#else
+
+void rcp_merge_queued() {}
+
+#endif
+
 } // namespace SymEngine
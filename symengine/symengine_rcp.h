@@ -14,11 +14,18 @@
 #include <symengine/symengine_config.h>
 #include <symengine/symengine_assert.h>
 
+#if defined(WITH_SYMENGINE_POOL_ALLOCATOR)
+#include <symengine/pool_allocator.h>
+#endif
+
 #if defined(WITH_SYMENGINE_RCP)
 
 #if defined(WITH_SYMENGINE_THREAD_SAFE)
 #include <atomic>
 #endif
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+#include <cstdint>
+#endif
 
 #else
 
@@ -33,6 +40,57 @@ namespace SymEngine
 
 #if defined(WITH_SYMENGINE_RCP)
 
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+
+/* Biased reference counting
+
+   Each object is owned by the thread that created it. The owner counts its
+   references in a plain `local_` counter, the other threads atomically
+   update `shared_`. Most copies happen in the thread that created the
+   object, so they need no locked instruction. `shared_` stores the count
+   times `rcp_shared_one` plus a state in the low two bits:
+
+   * 0: the counts are not merged. The shared count can be negative, as a
+     reference counted in `local_` can be released by another thread.
+   * `rcp_queued`: the shared count was zero when another thread released a
+     reference. Instead of decrementing, it queued the object to its owner,
+     which will merge the counts (the queue holds that reference).
+   * `rcp_merged`: the owner released its last reference, or merged a queued
+     object. The owner is reset to `rcp_no_owner`, and all threads use
+     `shared_`. The object is destroyed when that count drops to zero.
+
+   An owner merges its queue whenever one of its own objects is destroyed,
+   on `rcp_merge_queued()` and when it exits. Objects queued after their
+   owner exited are merged by the releasing thread.
+*/
+
+typedef std::uintptr_t rcp_thread_id;
+
+//! The owner of merged objects
+const rcp_thread_id rcp_no_owner = 0;
+//! The id of threads that did not create any object yet, or have exited
+const rcp_thread_id rcp_no_thread = ~rcp_thread_id(0);
+
+const std::intptr_t rcp_shared_one = 4;
+const std::intptr_t rcp_state_mask = 3;
+const std::intptr_t rcp_queued = 1;
+const std::intptr_t rcp_merged = 2;
+
+//! The id of the calling thread
+extern thread_local rcp_thread_id rcp_current_thread;
+//! Set when other threads queued objects for the calling thread
+extern thread_local std::atomic<bool> rcp_queue_pending;
+
+//! Registers the calling thread and returns its id, or `rcp_no_owner` if
+//! the thread is exiting
+rcp_thread_id rcp_register_thread();
+//! Queues the object `p` to its owner, `merge(p)` merges its counts. If the
+//! owner has exited, the object is merged immediately.
+void rcp_queue_merge(rcp_thread_id owner, const void *p,
+                     void (*merge)(const void *));
+
+#endif // WITH_SYMENGINE_BIASED_REFCOUNT
+
 /* Ptr */
 
 // Ptr is always pointing to a valid object (can never be nullptr).
@@ -114,20 +172,20 @@ public:
     explicit RCP(T *p) : ptr_(p)
     {
         SYMENGINE_ASSERT(ptr_ != nullptr)
-        (ptr_->refcount_)++;
+        ptr_->incref();
     }
     // Copy constructor
     RCP(const RCP<T> &rp) : ptr_(rp.ptr_)
     {
         if (not is_null())
-            (ptr_->refcount_)++;
+            ptr_->incref();
     }
     // Copy constructor
     template <class T2>
     RCP(const RCP<T2> &r_ptr) : ptr_(r_ptr.get())
     {
         if (not is_null())
-            (ptr_->refcount_)++;
+            ptr_->incref();
     }
     // Move constructor
     RCP(RCP<T> &&rp) SYMENGINE_NOEXCEPT : ptr_(rp.ptr_)
@@ -143,7 +201,7 @@ public:
     }
     ~RCP() SYMENGINE_NOEXCEPT
     {
-        if (ptr_ != nullptr and --(ptr_->refcount_) == 0)
+        if (ptr_ != nullptr and ptr_->decref())
             delete ptr_;
     }
     T *operator->() const
@@ -183,8 +241,8 @@ public:
     {
         T *r_ptr_ptr_ = r_ptr.ptr_;
         if (not r_ptr.is_null())
-            (r_ptr_ptr_->refcount_)++;
-        if (not is_null() and --(ptr_->refcount_) == 0)
+            r_ptr_ptr_->incref();
+        if (not is_null() and ptr_->decref())
             delete ptr_;
         ptr_ = r_ptr_ptr_;
         return *this;
@@ -197,7 +255,7 @@ public:
     }
     void reset()
     {
-        if (not is_null() and --(ptr_->refcount_) == 0)
+        if (not is_null() and ptr_->decref())
             delete ptr_;
         ptr_ = nullptr;
     }
@@ -277,6 +335,11 @@ using Teuchos::typeName;
 
 #endif
 
+//! Merges the reference counts of the objects that other threads queued for
+//! the calling thread (with biased reference counting), and destroys the
+//! unreferenced ones. Does nothing with the other reference counts.
+void rcp_merge_queued();
+
 template <class T>
 class EnableRCPFromThis
 {
@@ -313,9 +376,74 @@ public:
 #endif
     }
 
-    unsigned int use_count() const
+    //! Get RCP<const T> pointer to self, or a null RCP if the reference
+    //! count already dropped to zero (i.e. the object is being destroyed).
+    //! Used by tables that hold non-owning pointers (see intern.h).
+    inline RCP<const T> rcp_from_this_if_alive() const
     {
 #if defined(WITH_SYMENGINE_RCP)
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+        if (owner_.load(std::memory_order_relaxed) == rcp_current_thread) {
+            unsigned int count = local_.load(std::memory_order_relaxed);
+            if (count == 0)
+                return null;
+            local_.store(count + 1, std::memory_order_relaxed);
+        } else {
+            // Destroyed objects are always merged with a zero count first
+            std::intptr_t shared = shared_.load(std::memory_order_relaxed);
+            do {
+                if (shared == rcp_merged)
+                    return null;
+            } while (not shared_.compare_exchange_weak(
+                shared, shared + rcp_shared_one, std::memory_order_acq_rel));
+        }
+#elif defined(WITH_SYMENGINE_THREAD_SAFE)
+        unsigned int count = refcount_.load();
+        do {
+            if (count == 0)
+                return null;
+        } while (not refcount_.compare_exchange_weak(count, count + 1));
+#else
+        if (refcount_ == 0)
+            return null;
+        refcount_++;
+#endif
+        // We now own one reference, hand it over to the returned RCP
+        RCP<const T> r = rcp(static_cast<const T *>(this));
+        decref();
+        return r;
+#else
+        if (weak_self_ptr_.strong_count() == 0)
+            return null;
+        return rcp_from_this();
+#endif
+    }
+
+#if defined(WITH_SYMENGINE_POOL_ALLOCATOR)
+    //! Objects managed by RCP are allocated from the pool allocator (see
+    //! pool_allocator.h), both `make_rcp()` and the release in `RCP` end up
+    //! here.
+    static void *operator new(std::size_t size)
+    {
+        return pool_allocate(size);
+    }
+
+    static void operator delete(void *p, std::size_t size)
+    {
+        pool_deallocate(p, size);
+    }
+#endif
+
+    unsigned int use_count() const
+    {
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+        // Exact in the owner thread, or if the calling thread holds the only
+        // reference. Queued objects can be overestimated.
+        std::intptr_t shared = shared_.load(std::memory_order_acquire);
+        std::intptr_t count = (shared & ~rcp_state_mask) / rcp_shared_one
+                              + local_.load(std::memory_order_relaxed);
+        return count > 0 ? static_cast<unsigned int>(count) : 0;
+#elif defined(WITH_SYMENGINE_RCP)
         return refcount_;
 #else
         return weak_self_ptr_.strong_count();
@@ -332,18 +460,135 @@ private:
 // safe). Semantically they are almost equivalent, except that the
 // pre-decrement operator `operator--()` returns a copy for std::atomic
 // instead of a reference to itself.
+// With WITH_SYMENGINE_BIASED_REFCOUNT the counter is split into an owner
+// thread count and a shared count (see "Biased reference counting" above).
 // The refcount_ is defined as mutable, because it does not change the
 // state of the instance, but changes when more copies
 // of the same instance are made.
-#if defined(WITH_SYMENGINE_THREAD_SAFE)
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+    mutable std::atomic<rcp_thread_id> owner_;
+    // Only written by the owner, a relaxed load and store is enough
+    mutable std::atomic<unsigned int> local_;
+    mutable std::atomic<std::intptr_t> shared_;
+#elif defined(WITH_SYMENGINE_THREAD_SAFE)
     mutable std::atomic<unsigned int> refcount_; // reference counter
 #else
     mutable unsigned int refcount_; // reference counter
 #endif // WITH_SYMENGINE_THREAD_SAFE
 public:
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+    EnableRCPFromThis() : owner_(new_owner()), local_(0), shared_(0)
+    {
+        if (owner_.load(std::memory_order_relaxed) == rcp_no_owner)
+            shared_.store(rcp_merged, std::memory_order_relaxed);
+    }
+#else
     EnableRCPFromThis() : refcount_(0) {}
+#endif
 
 private:
+#if defined(WITH_SYMENGINE_BIASED_REFCOUNT)
+    static rcp_thread_id new_owner()
+    {
+        rcp_thread_id t = rcp_current_thread;
+        return t == rcp_no_thread ? rcp_register_thread() : t;
+    }
+
+    inline void incref() const
+    {
+        if (owner_.load(std::memory_order_relaxed) == rcp_current_thread) {
+            local_.store(local_.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+        } else {
+            shared_.fetch_add(rcp_shared_one, std::memory_order_relaxed);
+        }
+    }
+
+    //! \return true if the last reference was released
+    inline bool decref() const
+    {
+        if (owner_.load(std::memory_order_relaxed) == rcp_current_thread) {
+            unsigned int count = local_.load(std::memory_order_relaxed) - 1;
+            local_.store(count, std::memory_order_relaxed);
+            return count == 0 and release_local();
+        }
+        return release_shared();
+    }
+
+    // The owner released its last reference
+    bool release_local() const
+    {
+        std::intptr_t shared = 0;
+        bool last;
+        // Nobody else holds a reference. The compare and swap prevents
+        // `rcp_from_this_if_alive()` from resurrecting the object.
+        if (shared_.compare_exchange_strong(shared, rcp_merged,
+                                            std::memory_order_acq_rel)) {
+            last = true;
+        } else {
+            owner_.store(rcp_no_owner, std::memory_order_relaxed);
+            std::intptr_t merged;
+            do {
+                merged = (shared & ~rcp_state_mask) | rcp_merged;
+            } while (not shared_.compare_exchange_weak(
+                shared, merged, std::memory_order_acq_rel));
+            last = (merged == rcp_merged);
+        }
+        if (rcp_queue_pending.load(std::memory_order_relaxed))
+            rcp_merge_queued();
+        return last;
+    }
+
+    // Another thread released a reference
+    bool release_shared() const
+    {
+        std::intptr_t shared = shared_.load(std::memory_order_relaxed);
+        std::intptr_t n;
+        do {
+            n = (shared == 0) ? rcp_queued : shared - rcp_shared_one;
+        } while (not shared_.compare_exchange_weak(shared, n,
+                                                   std::memory_order_acq_rel));
+        if (shared == 0) {
+            rcp_queue_merge(owner_.load(std::memory_order_relaxed), this,
+                            &merge_queued);
+            return false;
+        }
+        return n == rcp_merged;
+    }
+
+    // Merges the counts of a queued object and releases the reference held
+    // by the queue. Runs in the owner thread, or after the owner exited.
+    static void merge_queued(const void *p)
+    {
+        const EnableRCPFromThis *self
+            = static_cast<const EnableRCPFromThis *>(p);
+        // Once merged, other threads can destroy the object at any time
+        std::intptr_t local = self->local_.load(std::memory_order_relaxed);
+        self->local_.store(0, std::memory_order_relaxed);
+        self->owner_.store(rcp_no_owner, std::memory_order_relaxed);
+        std::intptr_t shared = self->shared_.load(std::memory_order_relaxed);
+        std::intptr_t count;
+        do {
+            count = (shared & ~rcp_state_mask) / rcp_shared_one + local - 1;
+        } while (not self->shared_.compare_exchange_weak(
+            shared, count * rcp_shared_one + rcp_merged,
+            std::memory_order_acq_rel));
+        if (count == 0)
+            delete static_cast<const T *>(self);
+    }
+#else
+    inline void incref() const
+    {
+        refcount_++;
+    }
+
+    //! \return true if the last reference was released
+    inline bool decref() const
+    {
+        return --refcount_ == 0;
+    }
+#endif
+
 #else
     mutable RCP<T> weak_self_ptr_;
 
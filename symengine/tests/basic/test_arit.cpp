@@ -10,6 +10,7 @@
 
 using SymEngine::Add;
 using SymEngine::add;
+using SymEngine::AddBuilder;
 using SymEngine::Basic;
 using SymEngine::Complex;
 using SymEngine::complex_double;
@@ -30,6 +31,7 @@ using SymEngine::map_vec_uint;
 using SymEngine::minus_one;
 using SymEngine::Mul;
 using SymEngine::mul;
+using SymEngine::MulBuilder;
 using SymEngine::multinomial_coefficients;
 using SymEngine::Nan;
 using SymEngine::NegInf;
@@ -546,6 +548,60 @@ TEST_CASE("Mul: arit", "[arit]")
     REQUIRE(eq(*exp(s2), *s3));
 }
 
+TEST_CASE("AddBuilder and MulBuilder: arit", "[arit]")
+{
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> i2 = integer(2);
+    RCP<const Basic> i3 = integer(3);
+    RCP<const Basic> r1, r2;
+
+    AddBuilder a;
+    REQUIRE(eq(*a.build(), *zero));
+    a += x;
+    a += i2;
+    a += mul(i3, x);
+    a += add(y, i3);
+    r1 = a.build();
+    r2 = add({x, i2, mul(i3, x), y, i3});
+    REQUIRE(eq(*r1, *r2));
+    REQUIRE(eq(*r1, *add(add(mul(integer(4), x), y), integer(5))));
+    // The builder is empty after build()
+    REQUIRE(eq(*a.build(), *zero));
+
+    a.reserve(10);
+    a.add_term(integer(2), add(x, y));
+    a.add_term(integer(-2), x);
+    a += i3;
+    r1 = a.build();
+    REQUIRE(is_a<Add>(*r1));
+    REQUIRE(eq(*r1, *add(mul(i2, y), i3)));
+
+    a += x;
+    a += mul(integer(-1), x);
+    REQUIRE(eq(*a.build(), *zero));
+
+    MulBuilder m;
+    REQUIRE(eq(*m.build(), *one));
+    m *= x;
+    m *= i2;
+    m *= pow(x, i2);
+    m *= mul(i3, y);
+    r1 = m.build();
+    r2 = mul({x, i2, pow(x, i2), mul(i3, y)});
+    REQUIRE(eq(*r1, *r2));
+    REQUIRE(eq(*r1, *mul(mul(integer(6), pow(x, i3)), y)));
+    REQUIRE(eq(*m.build(), *one));
+
+    m *= x;
+    m *= div(one, x);
+    REQUIRE(eq(*m.build(), *one));
+
+    m *= x;
+    m *= zero;
+    REQUIRE(eq(*m.build(), *zero));
+}
+
 TEST_CASE("Sub: arit", "[arit]")
 {
     RCP<const Basic> x = symbol("x");
@@ -1485,3 +1541,77 @@ TEST_CASE("Expand3: arit", "[arit]")
                      .count()
               << "ms" << std::endl;
 }
+
+TEST_CASE("Expand4: arit", "[arit]")
+{
+    // Products of sums large enough to be expanded as polynomials, checked
+    // against the term by term product of the expanded factors
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> z = symbol("z");
+    RCP<const Basic> w = symbol("w");
+    RCP<const Basic> e1, e2, r1, r2;
+
+    auto check = [&](const RCP<const Basic> &a, const RCP<const Basic> &b) {
+        r1 = expand(mul(a, b));
+        r2 = expand(mul(expand(a), expand(b)), false);
+        REQUIRE(eq(*r1, *r2));
+    };
+
+    e1 = pow(add(add(add(x, y), z), w), integer(4));
+    check(e1, add(e1, w));
+    REQUIRE(down_cast<const Add &>(*r1).get_dict().size() == 200);
+
+    e1 = pow(add(add(div(x, integer(2)), div(y, integer(3))), one),
+             integer(12));
+    e2 = pow(add(sub(x, div(y, integer(5))), div(integer(2), integer(7))),
+             integer(12));
+    check(e1, e2);
+
+    e1 = pow(add(one, add(mul(sqrt(integer(3)), x), mul(sqrt(integer(5)), y))),
+             integer(8));
+    check(e1, add(e1, sqrt(integer(7))));
+
+    e1 = pow(add(add(div(one, x), sqrt(x)), one), integer(12));
+    e2 = pow(add(add(x, sqrt(x)), one), integer(12));
+    check(e1, e2);
+
+    e1 = pow(add(add(x, y), one), integer(20));
+    e2 = pow(sub(add(x, y), one), integer(20));
+    check(e1, e2);
+    r2 = expand(pow(sub(pow(add(x, y), integer(2)), one), integer(20)));
+    REQUIRE(eq(*r1, *r2));
+
+    // Inside a sum and with a numerical coefficient
+    r1 = expand(add(z, mul(div(integer(3), integer(4)), mul(e1, e2))));
+    r2 = expand(add(z, mul(div(integer(3), integer(4)), r2)));
+    REQUIRE(eq(*r1, *r2));
+}
+
+TEST_CASE("Expand with threads: arit", "[arit]")
+{
+    // Without OpenMP the number of threads is ignored
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> z = symbol("z");
+    RCP<const Basic> w = symbol("w");
+    RCP<const Basic> e, f, r1, r2;
+
+    // As polynomials
+    e = pow(add(add(add(x, y), z), one), integer(8));
+    f = mul(e, add(e, w));
+    r1 = expand(f);
+    for (unsigned threads : {0u, 2u, 3u, 8u}) {
+        r2 = expand(f, true, threads);
+        REQUIRE(eq(*r1, *r2));
+    }
+
+    // Term by term, with a symbolic exponent
+    e = pow(add(add(add(pow(x, y), y), z), div(one, integer(3))), integer(8));
+    f = mul(e, add(e, w));
+    r1 = expand(f);
+    for (unsigned threads : {0u, 2u, 3u, 8u}) {
+        r2 = expand(f, true, threads);
+        REQUIRE(eq(*r1, *r2));
+    }
+}
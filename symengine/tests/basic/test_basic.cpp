@@ -4,6 +4,7 @@
 #include <symengine/eval_double.h>
 #include <symengine/derivative.h>
 #include <symengine/symengine_exception.h>
+#include <symengine/intern.h>
 #include <cstring>
 
 using SymEngine::Add;
@@ -16,6 +17,9 @@ using SymEngine::ComplexInf;
 using SymEngine::diff;
 using SymEngine::down_cast;
 using SymEngine::EulerGamma;
+using SymEngine::FlatHashMap;
+using SymEngine::FlatMap;
+using SymEngine::fmap_basic_basic;
 using SymEngine::free_symbols;
 using SymEngine::function_symbol;
 using SymEngine::FunctionSymbol;
@@ -26,6 +30,7 @@ using SymEngine::Inf;
 using SymEngine::infty;
 using SymEngine::Integer;
 using SymEngine::integer;
+using SymEngine::interned_count;
 using SymEngine::is_a;
 using SymEngine::make_rcp;
 using SymEngine::map_basic_basic;
@@ -251,6 +256,138 @@ TEST_CASE("Symbol dict: Basic", "[basic]")
     REQUIRE(unified_compare(msba, {x, y, i3}) == -1);
 }
 
+TEST_CASE("FlatHashMap: Basic", "[basic]")
+{
+    FlatHashMap<int, int> m;
+    REQUIRE(m.empty());
+    REQUIRE(m.find(1) == m.end());
+    REQUIRE(m.begin() == m.end());
+
+    for (int i = 0; i < 1000; i++) {
+        REQUIRE(m.insert({i, 2 * i}).second);
+    }
+    REQUIRE(m.size() == 1000);
+    REQUIRE(not m.insert({5, 0}).second);
+    REQUIRE(m.at(5) == 10);
+    REQUIRE(m.bucket_count() >= 1000);
+
+    // Erase the odd keys while iterating
+    for (auto it = m.begin(); it != m.end();) {
+        if (it->first % 2 == 1) {
+            it = m.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    REQUIRE(m.size() == 500);
+    long sum = 0;
+    for (const auto &p : m) {
+        REQUIRE(p.first % 2 == 0);
+        REQUIRE(p.second == 2 * p.first);
+        sum += p.first;
+    }
+    REQUIRE(sum == 249500);
+    REQUIRE(m.count(7) == 0);
+    REQUIRE(m.erase(8) == 1);
+    REQUIRE(m.erase(8) == 0);
+
+    // Reinserting reuses the tombstones
+    size_t buckets = m.bucket_count();
+    for (int i = 1; i < 1000; i += 2) {
+        m[i] = 2 * i;
+    }
+    m.emplace(8, 16);
+    REQUIRE(m.size() == 1000);
+    REQUIRE(m.bucket_count() == buckets);
+    for (int i = 0; i < 1000; i++) {
+        REQUIRE(m.find(i) != m.end());
+        REQUIRE(m[i] == 2 * i);
+    }
+
+    FlatHashMap<int, int> m2 = m;
+    REQUIRE(m2 == m);
+    m2[0] = 1;
+    REQUIRE(m2 != m);
+    REQUIRE(unified_compare(m, m2) == -1);
+    FlatHashMap<int, int> m3 = std::move(m2);
+    REQUIRE(m2.empty());
+    REQUIRE(m3.size() == 1000);
+    m3.clear();
+    REQUIRE(m3.empty());
+    REQUIRE(m3.find(0) == m3.end());
+    REQUIRE_THROWS_AS(m3.at(0), std::out_of_range);
+
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    umap_basic_num d = {{x, integer(1)}}, d2;
+    insert(d, y, integer(2));
+    insert(d2, y, integer(2));
+    insert(d2, x, integer(1));
+    REQUIRE(unified_eq(d, d2));
+    d2.erase(x);
+    REQUIRE(not unified_eq(d, d2));
+}
+
+TEST_CASE("FlatMap: Basic", "[basic]")
+{
+    FlatMap<int, int> m;
+    REQUIRE(m.empty());
+    REQUIRE(m.find(1) == m.end());
+    for (int i : {5, 3, 9, 1, 7}) {
+        REQUIRE(m.insert({i, 2 * i}).second);
+    }
+    REQUIRE(not m.insert({3, 0}).second);
+    REQUIRE(m.size() == 5);
+    // Iteration is in key order
+    int last = 0;
+    for (const auto &p : m) {
+        REQUIRE(p.first > last);
+        REQUIRE(p.second == 2 * p.first);
+        last = p.first;
+    }
+    REQUIRE(m.at(7) == 14);
+    REQUIRE(m.count(4) == 0);
+    REQUIRE(m.lower_bound(4)->first == 5);
+    REQUIRE(m.upper_bound(5)->first == 7);
+    m[4] = 8;
+    REQUIRE(m.begin()[2].first == 4);
+    REQUIRE(m.erase(4) == 1);
+    REQUIRE(m.erase(4) == 0);
+    auto it = m.erase(m.find(5));
+    REQUIRE(it->first == 7);
+    REQUIRE_THROWS_AS(m.at(5), std::out_of_range);
+
+    // Appending keys in order with a hint does not search
+    FlatMap<int, int> m2;
+    for (int i = 0; i < 10; i++) {
+        m2.emplace_hint(m2.end(), i, i);
+    }
+    m2.emplace_hint(m2.begin(), 20, 20);
+    REQUIRE(m2.size() == 11);
+    REQUIRE(m2.rbegin()->first == 20);
+
+    // Duplicates keep the first value, as with insert()
+    FlatMap<int, int> m3 = {{2, 1}, {1, 1}, {2, 2}};
+    REQUIRE(m3.size() == 2);
+    REQUIRE(m3.at(2) == 1);
+    FlatMap<int, int> m4(SymEngine::sorted_unique, m2.begin() + 1, m2.end());
+    REQUIRE(m4.size() == 10);
+    REQUIRE(m4.begin()->first == 1);
+
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    fmap_basic_basic d, d2;
+    insert(d, x, integer(2));
+    insert(d, y, integer(3));
+    insert(d2, y, integer(3));
+    insert(d2, x, integer(2));
+    REQUIRE(unified_eq(d, d2));
+    REQUIRE(unified_compare(d, d2) == 0);
+    d2[x] = integer(1);
+    REQUIRE(not unified_eq(d, d2));
+    REQUIRE(unified_compare(d, d2) == -unified_compare(d2, d));
+}
+
 TEST_CASE("Add: basic", "[basic]")
 {
     umap_basic_num m, m2;
@@ -496,7 +633,7 @@ TEST_CASE("Rational: Basic", "[basic]")
 
 TEST_CASE("Mul: Basic", "[basic]")
 {
-    map_basic_basic m, m2;
+    fmap_basic_basic m, m2;
     RCP<const Basic> x = symbol("x");
     RCP<const Basic> y = symbol("y");
     insert(m, x, integer(2));
@@ -536,7 +673,7 @@ TEST_CASE("Mul: Basic", "[basic]")
     r = mul(mul(mul(x, y), mul(x, integer(2))), integer(3));
     RCP<const Mul> mr = rcp_static_cast<const Mul>(r);
     REQUIRE(eq(*mr->get_coef(), *integer(6)));
-    const map_basic_basic &mulmap = mr->get_dict();
+    const fmap_basic_basic &mulmap = mr->get_dict();
     auto search = mulmap.find(x);
     REQUIRE(search != mulmap.end());
     REQUIRE(eq(*search->second, *integer(2)));
@@ -999,6 +1136,16 @@ TEST_CASE("has_symbol: Basic", "[basic]")
     REQUIRE(has_symbol(*r1, *x));
     REQUIRE(has_symbol(*r1, *y));
     REQUIRE(not has_symbol(*r1, *z));
+
+    r1 = add(integer(3), mul(integer(2), mul(x, pow(y, z))));
+    REQUIRE(has_symbol(*r1, *x));
+    REQUIRE(has_symbol(*r1, *y));
+    REQUIRE(has_symbol(*r1, *z));
+    REQUIRE(not has_symbol(*r1, *symbol("w")));
+
+    r1 = function_symbol("f", mul(x, y));
+    REQUIRE(has_symbol(*r1, *y));
+    REQUIRE(has_symbol(*r1, *r1));
 }
 
 TEST_CASE("coeff: Basic", "[basic]")
@@ -1084,6 +1231,11 @@ TEST_CASE("free_symbols: Basic", "[basic]")
     s = free_symbols(*r1);
     REQUIRE(s.size() == 1);
     REQUIRE(s.count(x) == 1);
+
+    r1 = add(mul(integer(2), pow(x, y)), mul(integer(3), sin(z)));
+    s = free_symbols(*r1);
+    REQUIRE(s.size() == 3);
+    REQUIRE(s.count(y) == 1);
 }
 
 TEST_CASE("function_symbols: Basic", "[basic]")
@@ -1166,4 +1318,141 @@ TEST_CASE("args: Basic", "[basic]")
 
     r1 = log(pi);
     REQUIRE(vec_basic_eq_perm(r1->get_args(), {pi}));
+
+    // for_each_arg() visits the same arguments as get_args()
+    vec_basic exprs = {add(integer(2), add(x, mul(integer(3), pow(y, x)))),
+                       mul(integer(2), mul(x, pow(y, integer(3)))),
+                       pow(x, y),
+                       sin(x),
+                       atan2(x, y),
+                       SymEngine::max({x, y, integer(2)}),
+                       function_symbol("f", {x, y}),
+                       function_symbol("g", x)->diff(x),
+                       pi,
+                       integer(2),
+                       x};
+    for (const auto &e : exprs) {
+        vec_basic args;
+        e->for_each_arg([&args](const RCP<const Basic> &a) {
+            args.push_back(a);
+        });
+        REQUIRE(unified_eq(args, e->get_args()));
+    }
+}
+
+class NodeRecorder : public SymEngine::BaseVisitor<NodeRecorder>
+{
+public:
+    vec_basic nodes;
+
+    void bvisit(const Basic &x)
+    {
+        nodes.push_back(x.rcp_from_this());
+    }
+};
+
+void preorder_nodes(const RCP<const Basic> &b, vec_basic &nodes)
+{
+    nodes.push_back(b);
+    for (const auto &p : b->get_args())
+        preorder_nodes(p, nodes);
+}
+
+void postorder_nodes(const RCP<const Basic> &b, vec_basic &nodes)
+{
+    for (const auto &p : b->get_args())
+        postorder_nodes(p, nodes);
+    nodes.push_back(b);
+}
+
+TEST_CASE("traversal: Basic", "[basic]")
+{
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> r1
+        = add(mul(integer(2), pow(x, y)), sin(add(x, mul(x, y))));
+
+    vec_basic expected;
+    NodeRecorder pre;
+    preorder_traversal(*r1, pre);
+    preorder_nodes(r1, expected);
+    REQUIRE(unified_eq(pre.nodes, expected));
+
+    expected.clear();
+    NodeRecorder post;
+    postorder_traversal(*r1, post);
+    postorder_nodes(r1, expected);
+    REQUIRE(unified_eq(post.nodes, expected));
+
+    // Every distinct node is visited once
+    NodeRecorder once;
+    preorder_traversal(*r1, once, true);
+    REQUIRE(once.nodes.size() == 9);
+    NodeRecorder post_once;
+    postorder_traversal(*r1, post_once, true);
+    REQUIRE(post_once.nodes.size() == 9);
+    REQUIRE(eq(*post_once.nodes.back(), *r1));
+
+    // f_{n+1} = f_n*(f_n + y) + x has 2**60 nodes in its tree, but only
+    // O(60) distinct nodes
+    RCP<const Basic> f = x;
+    for (unsigned n = 0; n < 60; n++) {
+        f = add(mul(f, add(f, y)), x);
+    }
+    NodeRecorder dag;
+    preorder_traversal(*f, dag, true);
+    REQUIRE(dag.nodes.size() < 300);
+    set_basic s = free_symbols(*f);
+    REQUIRE(s.size() == 2);
+    REQUIRE(has_symbol(*f, *y));
+    REQUIRE(not has_basic(*f, *sin(x)));
+    REQUIRE(atoms<Symbol>(*f).size() == 2);
+    REQUIRE(SymEngine::rewrite_as_exp(f)->hash() == f->hash());
+
+    // Deep nesting does not use the call stack
+    RCP<const Basic> g = x;
+    for (unsigned n = 0; n < 10000; n++) {
+        g = function_symbol("f", g);
+    }
+    NodeRecorder deep;
+    postorder_traversal(*g, deep);
+    REQUIRE(deep.nodes.size() == 10001);
+    REQUIRE(eq(*deep.nodes.front(), *x));
+    REQUIRE(has_symbol(*g, *x));
+    REQUIRE(SymEngine::count_ops({g}) == 10000);
+}
+
+TEST_CASE("Interning: Basic", "[basic]")
+{
+    RCP<const Basic> x, y, r1, r2;
+
+    x = symbol("x");
+    REQUIRE(not x->is_interned());
+
+    SymEngine::set_interning(true);
+    REQUIRE(SymEngine::interning_enabled());
+    size_t count = interned_count();
+
+    x = symbol("x");
+    y = symbol("y");
+    REQUIRE(x->is_interned());
+    REQUIRE(x.get() == symbol("x").get());
+    REQUIRE(x.get() != y.get());
+
+    r1 = add(mul(integer(2), x), pow(y, integer(2)));
+    r2 = add(pow(y, integer(2)), mul(x, integer(2)));
+    REQUIRE(r1->is_interned());
+    REQUIRE(r1.get() == r2.get());
+    REQUIRE(pow(x, y).get() == pow(x, y).get());
+    REQUIRE(mul(x, y).get() == mul(y, x).get());
+    REQUIRE(interned_count() > count);
+
+    // Interned nodes are not kept alive by the table
+    r1 = r2 = x = y = SymEngine::null;
+    REQUIRE(interned_count() == count);
+
+    SymEngine::set_interning(false);
+    x = symbol("x");
+    REQUIRE(not x->is_interned());
+    REQUIRE(x.get() != symbol("x").get());
 }
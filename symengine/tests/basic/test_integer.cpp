@@ -2,9 +2,12 @@
 
 #include <symengine/integer.h>
 #include <symengine/mul.h>
+#include <symengine/pow.h>
+#include <symengine/rational.h>
 #include <symengine/symengine_exception.h>
 
 using SymEngine::Basic;
+using SymEngine::down_cast;
 using SymEngine::Integer;
 using SymEngine::integer;
 using SymEngine::integer_class;
@@ -13,6 +16,7 @@ using SymEngine::mp_get_hex_str;
 using SymEngine::mp_set_str;
 using SymEngine::neg;
 using SymEngine::print_stack_on_segfault;
+using SymEngine::rational;
 using SymEngine::RCP;
 using SymEngine::SymEngineException;
 
@@ -122,3 +126,70 @@ TEST_CASE("fix#461: integer", "[integer]")
     CHECK(ir->__str__() == "-12345");
     CHECK(mp_get_hex_str(val) == "-3039");
 }
+
+TEST_CASE("machine word fast paths: integer", "[integer]")
+{
+    long lmax = std::numeric_limits<long>::max();
+    long lmin = std::numeric_limits<long>::min();
+    integer_class big_max(lmax), big_min(lmin);
+    RCP<const Integer> imax = integer(lmax), imin = integer(lmin);
+    RCP<const Integer> i1 = integer(1), i2 = integer(2), im1 = integer(-1);
+    long r;
+
+    REQUIRE(SymEngine::mp_get_si_if_fits(big_max, r));
+    REQUIRE(r == lmax);
+    REQUIRE(SymEngine::mp_get_si_if_fits(big_min, r));
+    REQUIRE(r == lmin);
+    REQUIRE(not SymEngine::mp_get_si_if_fits(big_max + 1u, r));
+    REQUIRE(not SymEngine::mp_get_si_if_fits(big_min - 1u, r));
+
+    // Results that overflow a long fall back to integer_class
+    REQUIRE(imax->addint(*i1)->as_integer_class() == big_max + 1u);
+    REQUIRE(imin->subint(*i1)->as_integer_class() == big_min - 1u);
+    REQUIRE(imax->mulint(*i2)->as_integer_class() == big_max * 2u);
+    REQUIRE(imin->mulint(*im1)->as_integer_class() == -big_min);
+    REQUIRE(imax->addint(*im1)->as_integer_class() == big_max - 1u);
+    REQUIRE(eq(*integer(-7)->mulint(*integer(6)), *integer(-42)));
+
+    integer_class p;
+    SymEngine::mp_pow_ui(p, integer_class(3), 40);
+    REQUIRE(down_cast<const Integer &>(*integer(3)->powint(*integer(40)))
+                .as_integer_class()
+            == p);
+    REQUIRE(eq(*integer(-3)->powint(*integer(3)), *integer(-27)));
+    REQUIRE(eq(*integer(2)->powint(*integer(0)), *integer(1)));
+}
+
+TEST_CASE("preallocated small numbers: integer", "[integer]")
+{
+    REQUIRE(integer(0).get() == SymEngine::zero.get());
+    REQUIRE(integer(5).get() == integer(5).get());
+    REQUIRE(integer(-1024).get() == integer(integer_class(-1024)).get());
+    REQUIRE(integer(1024u).get() == integer(1024L).get());
+    REQUIRE(integer(1025).get() != integer(1025).get());
+    REQUIRE(integer(-1025).get() != integer(-1025).get());
+    REQUIRE(eq(*integer(1025), *integer(1025)));
+
+    REQUIRE(integer(3)->addint(*integer(4)).get() == integer(7).get());
+    REQUIRE(integer(3)->subint(*integer(4)).get()
+            == SymEngine::minus_one.get());
+    REQUIRE(integer(-3)->mulint(*integer(4)).get() == integer(-12).get());
+    REQUIRE(integer(2)->powint(*integer(10)).get() == integer(1024).get());
+    REQUIRE(integer(5)->neg().get() == integer(-5).get());
+
+    REQUIRE(rational(1, 2).get() == rational(2, 4).get());
+    REQUIRE(rational(-1, 2).get() == rational(1, -2).get());
+    REQUIRE(rational(16, 15).get() == rational(-16, -15).get());
+    REQUIRE(rational(1, 17).get() != rational(1, 17).get());
+    REQUIRE(rational(4, 2).get() == integer(2).get());
+
+    RCP<const Basic> s2 = SymEngine::sqrt(integer(2));
+    REQUIRE(s2.get() == SymEngine::sqrt(integer(2)).get());
+    REQUIRE(s2->__str__() == "sqrt(2)");
+    RCP<const Basic> is6 = SymEngine::pow(integer(6), rational(-1, 2));
+    REQUIRE(is6.get() == SymEngine::pow(integer(6), rational(-1, 2)).get());
+    REQUIRE(is6->__str__() == "(1/6)*sqrt(6)");
+    REQUIRE(SymEngine::sqrt(integer(8))->__str__() == "sqrt(8)");
+    REQUIRE(eq(*SymEngine::sqrt(integer(65)),
+               *SymEngine::pow(integer(65), rational(1, 2))));
+}
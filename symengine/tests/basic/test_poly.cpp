@@ -88,3 +88,65 @@ TEST_CASE("expand: poly", "[poly]")
                      .count()
               << "ms" << std::endl;
 }
+
+// The product `A*B` by the term by term loop on unpacked exponents
+umap_vec_mpz naive_poly_mul(const umap_vec_mpz &A, const umap_vec_mpz &B)
+{
+    umap_vec_mpz C;
+    vec_int exp(A.begin()->first.size(), 0);
+    for (const auto &a : A) {
+        for (const auto &b : B) {
+            monomial_mul(a.first, b.first, exp);
+            mp_addmul(C[exp], a.second, b.second);
+        }
+    }
+    return C;
+}
+
+TEST_CASE("poly_mul: packed exponents and threads", "[poly]")
+{
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> z = symbol("z");
+    RCP<const Basic> w = symbol("w");
+
+    // Large enough to be split among threads when built with OpenMP
+    RCP<const Basic> e = pow(add(add(add(x, y), z), w), integer(10));
+    umap_basic_num syms;
+    insert(syms, x, integer(0));
+    insert(syms, y, integer(1));
+    insert(syms, z, integer(2));
+    insert(syms, w, integer(3));
+    umap_vec_mpz P1, P2;
+    expr2poly(expand(e), syms, P1);
+    expr2poly(expand(add(e, w)), syms, P2);
+    umap_vec_mpz R = naive_poly_mul(P1, P2);
+    for (unsigned threads : {0u, 1u, 3u}) {
+        umap_vec_mpz C;
+        poly_mul(P1, P2, C, threads);
+        REQUIRE(C == R);
+    }
+
+    // The product is added to C
+    umap_vec_mpz C = P1;
+    poly_mul(P1, P2, C);
+    for (const auto &t : P1)
+        R[t.first] += t.second;
+    REQUIRE(C == R);
+
+    // Negative exponents, and exponents too large to be packed
+    umap_vec_mpz A, B;
+    A[{1, -2}] = 3;
+    A[{0, 1}] = -1;
+    B[{2, 5}] = 7;
+    B[{0, 0}] = 1;
+    C.clear();
+    poly_mul(A, B, C);
+    REQUIRE(C == naive_poly_mul(A, B));
+    A.clear();
+    A[{1 << 30, 1 << 30}] = 2;
+    A[{1, 0}] = 1;
+    C.clear();
+    poly_mul(A, A, C);
+    REQUIRE(C == naive_poly_mul(A, A));
+}
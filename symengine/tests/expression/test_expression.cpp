@@ -3,6 +3,7 @@
 
 #include <symengine/expression.h>
 
+using SymEngine::AddBuilder;
 using SymEngine::complex_double;
 using SymEngine::cos;
 using SymEngine::eq;
@@ -63,6 +64,20 @@ TEST_CASE("Arithmetic of Expression", "[Expression]")
     std::cout << res << std::endl;
 }
 
+TEST_CASE("Summation of Expression with AddBuilder", "[Expression]")
+{
+    Expression x("x");
+    Expression s = 0;
+    AddBuilder b;
+    for (int i = 1; i <= 20; i++) {
+        Expression t = i * pow(x, i);
+        s += t;
+        b += t;
+    }
+    Expression e(b.build());
+    REQUIRE(e == s);
+}
+
 TEST_CASE("Substitution of Expression", "[Expression]")
 {
     const Expression x("x");
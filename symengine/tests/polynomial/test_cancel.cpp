@@ -2,26 +2,33 @@
 #include <chrono>
 
 #include <symengine/polys/cancel.h>
+#include <symengine/polys/uintpoly.h>
 #include <symengine/polys/uintpoly_flint.h>
 
 using SymEngine::Basic;
 using SymEngine::cancel;
 using SymEngine::exp;
+using SymEngine::expand;
 using SymEngine::integer;
+using SymEngine::MIntPoly;
 using SymEngine::mul;
 using SymEngine::pow;
 using SymEngine::RCP;
 using SymEngine::sub;
 using SymEngine::symbol;
+using SymEngine::UIntPoly;
+#ifdef HAVE_SYMENGINE_FLINT
 using SymEngine::UIntPolyFlint;
+#endif
 
 using namespace SymEngine::literals;
 
-TEST_CASE("cancel", "[Basic]")
+template <typename Poly>
+void test_cancel()
 {
     RCP<const Basic> x = symbol("x");
     RCP<const Basic> y = symbol("y");
-    RCP<const UIntPolyFlint> numer, denom, common;
+    RCP<const Poly> numer, denom, common;
 
     // 2*x / x = 2 / 1
     cancel(mul(x, integer(2)), x, outArg(numer), outArg(denom), outArg(common));
@@ -58,3 +65,54 @@ TEST_CASE("cancel", "[Basic]")
     REQUIRE(denom->__str__() == "1");
     REQUIRE(common->__str__() == "exp(x) + 1");
 }
+
+TEST_CASE("cancel", "[Basic]")
+{
+    test_cancel<UIntPoly>();
+#ifdef HAVE_SYMENGINE_FLINT
+    test_cancel<UIntPolyFlint>();
+#endif
+}
+
+TEST_CASE("cancel MIntPoly", "[Basic]")
+{
+    RCP<const Basic> x = symbol("x");
+    RCP<const Basic> y = symbol("y");
+    RCP<const Basic> z = symbol("z");
+    RCP<const MIntPoly> numer, denom, common;
+
+    // 2*x*y / (4*x) = y / 2
+    cancel(mul(mul(x, y), integer(2)), mul(x, integer(4)), outArg(numer),
+           outArg(denom), outArg(common));
+    REQUIRE(eq(*numer->as_symbolic(), *y));
+    REQUIRE(eq(*denom->as_symbolic(), *integer(2)));
+    REQUIRE(eq(*common->as_symbolic(), *mul(x, integer(2))));
+
+    // (x**2 - y**2) / (x*y + y**2) = (x - y) / y
+    cancel(sub(pow(x, integer(2)), pow(y, integer(2))),
+           add(mul(x, y), pow(y, integer(2))), outArg(numer), outArg(denom),
+           outArg(common));
+    REQUIRE(eq(*numer->as_symbolic(), *sub(x, y)));
+    REQUIRE(eq(*denom->as_symbolic(), *y));
+    REQUIRE(eq(*common->as_symbolic(), *add(x, y)));
+
+    // (x*z + y*z) / (x**2*z + 2*x*y*z + y**2*z + z) = (x + y) / (x**2 +
+    // 2*x*y + y**2 + 1)
+    RCP<const Basic> d = expand(
+        mul(z, add(pow(add(x, y), integer(2)), integer(1))));
+    cancel(expand(mul(z, add(x, y))), d, outArg(numer), outArg(denom),
+           outArg(common));
+    REQUIRE(eq(*numer->as_symbolic(), *add(x, y)));
+    REQUIRE(eq(*denom->as_symbolic(),
+               *expand(add(pow(add(x, y), integer(2)), integer(1)))));
+    REQUIRE(eq(*common->as_symbolic(), *z));
+
+    // (6*x*y*z + 6*z) / (4*x*y + 4) = 3*z / 2
+    RCP<const Basic> xy1 = add(mul(x, y), integer(1));
+    cancel(expand(mul(integer(6), mul(z, xy1))),
+           expand(mul(integer(4), xy1)), outArg(numer), outArg(denom),
+           outArg(common));
+    REQUIRE(eq(*numer->as_symbolic(), *mul(integer(3), z)));
+    REQUIRE(eq(*denom->as_symbolic(), *integer(2)));
+    REQUIRE(eq(*common->as_symbolic(), *expand(mul(integer(2), xy1))));
+}
@@ -5,14 +5,20 @@
 
 using SymEngine::add;
 using SymEngine::Basic;
+using SymEngine::divides_mpoly;
 using SymEngine::Expression;
+using SymEngine::gcd_mpoly;
 using SymEngine::integer;
 using SymEngine::Integer;
 using SymEngine::integer_class;
 using SymEngine::make_rcp;
 using SymEngine::map_uint_mpz;
+using SymEngine::MIntDict;
 using SymEngine::MIntPoly;
+using SymEngine::mul_mpoly;
+using SymEngine::neg_mpoly;
 using SymEngine::one;
+using SymEngine::outArg;
 using SymEngine::Pow;
 using SymEngine::Precedence;
 using SymEngine::PrecedenceEnum;
@@ -21,6 +27,7 @@ using SymEngine::RCP;
 using SymEngine::RCPBasicKeyLess;
 using SymEngine::Symbol;
 using SymEngine::symbol;
+using SymEngine::UDictWrapper;
 using SymEngine::UIntPoly;
 using SymEngine::vec_basic;
 using SymEngine::vec_int;
@@ -578,6 +585,81 @@ TEST_CASE("MIntPoly from_poly", "[MIntPoly]")
 
     REQUIRE(eq(*MIntPoly::from_poly(*upoly), *mpoly));
 }
+
+TEST_CASE("MIntDict::mul", "[MIntPoly]")
+{
+    typedef UDictWrapper<vec_uint, integer_class, MIntDict> Generic;
+
+    // (x - y + 2*z + 3)**2 * (x*z - 5*y**2 + 1), with cancellations
+    MIntDict a({{{1, 0, 0}, 1_z}, {{0, 1, 0}, -1_z}, {{0, 0, 1}, 2_z},
+                {{0, 0, 0}, 3_z}},
+               3);
+    MIntDict b({{{1, 0, 1}, 1_z}, {{0, 2, 0}, -5_z}, {{0, 0, 0}, 1_z}}, 3);
+    MIntDict a2 = MIntDict::mul(a, a);
+    REQUIRE(a2.dict_.size() == 10);
+    REQUIRE(a2 == Generic::mul(a, a));
+    REQUIRE(MIntDict::mul(a2, b) == Generic::mul(a2, b));
+    REQUIRE(MIntDict::mul(b, a2) == Generic::mul(a2, b));
+    REQUIRE(MIntDict::mul(a, -a) + a2 == MIntDict(3));
+    REQUIRE(MIntDict::mul(a, MIntDict(3)) == MIntDict(3));
+
+    // The exponents of the product do not fit into a word
+    unsigned big = 1u << 30;
+    MIntDict c({{{big, big, 1}, 2_z}, {{1, 0, big}, 1_z}}, 3);
+    MIntDict c2 = MIntDict::mul(c, c);
+    REQUIRE(c2 == Generic::mul(c, c));
+    REQUIRE(c2.get_dict().at({2, 0, 2 * big}) == 1_z);
+
+    MIntDict d({{{}, 7_z}}, 0);
+    REQUIRE(MIntDict::mul(d, d).get_dict().at({}) == 49_z);
+}
+
+TEST_CASE("MIntPoly gcd", "[MIntPoly]")
+{
+    RCP<const Symbol> x = symbol("x");
+    RCP<const Symbol> y = symbol("y");
+    RCP<const Symbol> z = symbol("z");
+    RCP<const MIntPoly> r;
+
+    // f = 2*x*y + 3*z**2 + 1, g = x**2 - y*z + 5, h = 3*x*z - y**3 - 7
+    RCP<const MIntPoly> f = MIntPoly::from_dict(
+        {x, y, z}, {{{1, 1, 0}, 2_z}, {{0, 0, 2}, 3_z}, {{0, 0, 0}, 1_z}});
+    RCP<const MIntPoly> g = MIntPoly::from_dict(
+        {x, y, z}, {{{2, 0, 0}, 1_z}, {{0, 1, 1}, -1_z}, {{0, 0, 0}, 5_z}});
+    RCP<const MIntPoly> h = MIntPoly::from_dict(
+        {x, y, z}, {{{1, 0, 1}, 3_z}, {{0, 3, 0}, -1_z}, {{0, 0, 0}, -7_z}});
+    RCP<const MIntPoly> six
+        = MIntPoly::from_dict({x, y, z}, {{{0, 0, 0}, 6_z}});
+    RCP<const MIntPoly> four
+        = MIntPoly::from_dict({x, y, z}, {{{0, 0, 0}, -4_z}});
+    RCP<const MIntPoly> zero = MIntPoly::from_dict({x, y, z}, {});
+    RCP<const MIntPoly> fg = mul_mpoly(*f, *g);
+
+    REQUIRE(eq(*gcd_mpoly(*mul_mpoly(*fg, *six), *mul_mpoly(*f, *h)), *f));
+    REQUIRE(eq(*gcd_mpoly(*mul_mpoly(*fg, *six), *mul_mpoly(*mul_mpoly(*f, *h),
+                                                             *four)),
+               *mul_mpoly(*f, *MIntPoly::from_dict(
+                                  {x, y, z}, {{{0, 0, 0}, 2_z}}))));
+    REQUIRE(eq(*gcd_mpoly(*mul_mpoly(*fg, *g), *mul_mpoly(*g, *h)), *g));
+    REQUIRE(eq(*gcd_mpoly(*mul_mpoly(*fg, *fg), *mul_mpoly(*fg, *h)), *fg));
+    REQUIRE(gcd_mpoly(*g, *h)->__str__() == "1");
+    REQUIRE(eq(*gcd_mpoly(*zero, *neg_mpoly(*f)), *f));
+    REQUIRE(eq(*gcd_mpoly(*six, *four), *MIntPoly::from_dict(
+                                           {x, y, z}, {{{0, 0, 0}, 2_z}})));
+
+    // Different generators
+    RCP<const MIntPoly> p = MIntPoly::from_dict({x, y}, {{{1, 1}, 1_z},
+                                                         {{0, 0}, 1_z}});
+    RCP<const MIntPoly> q = MIntPoly::from_dict({y, z}, {{{0, 1}, 1_z}});
+    r = gcd_mpoly(*mul_mpoly(*p, *q), *p);
+    REQUIRE(eq(*r->as_symbolic(), *p->as_symbolic()));
+
+    REQUIRE(divides_mpoly(*f, *fg, outArg(r)));
+    REQUIRE(eq(*r, *g));
+    REQUIRE(not divides_mpoly(*g, *f, outArg(r)));
+    REQUIRE(not divides_mpoly(*six, *f, outArg(r)));
+    REQUIRE(not divides_mpoly(*zero, *f, outArg(r)));
+}
 /*
 TEST_CASE("Testing equality of MultivariateExprPolynomials with Expressions",
           "[MultivariateExprPolynomial],[Expression]")
@@ -272,6 +272,111 @@ TEST_CASE("UIntPoly divides", "[UIntPoly]")
     REQUIRE(!divides_upoly(*b, *a, outArg(res)));
 }
 
+TEST_CASE("UIntPoly gcd", "[UIntPoly]")
+{
+    RCP<const Symbol> x = symbol("x");
+    RCP<const UIntPoly> a = UIntPoly::from_dict(x, {{2, 2_z}});
+    RCP<const UIntPoly> b = UIntPoly::from_dict(x, {{1, 3_z}});
+    RCP<const UIntPoly> c
+        = UIntPoly::from_dict(x, {{0, 6_z}, {1, 8_z}, {2, 2_z}});
+    RCP<const UIntPoly> d = UIntPoly::from_dict(x, {{1, 4_z}, {2, 4_z}});
+    RCP<const UIntPoly> e = UIntPoly::from_dict(x, {{0, -4_z}, {1, -4_z}});
+    RCP<const UIntPoly> z = UIntPoly::from_dict(x, {{0, 0_z}});
+
+    REQUIRE(gcd_upoly(*a, *b)->__str__() == "x");
+    REQUIRE(gcd_upoly(*c, *d)->__str__() == "2*x + 2");
+    REQUIRE(gcd_upoly(*a, *d)->__str__() == "2*x");
+    REQUIRE(gcd_upoly(*b, *c)->__str__() == "1");
+    REQUIRE(gcd_upoly(*c, *e)->__str__() == "2*x + 2");
+    REQUIRE(gcd_upoly(*e, *z)->__str__() == "4*x + 4");
+    REQUIRE(gcd_upoly(*z, *z)->__str__() == "0");
+
+    // Coefficients larger than the primes used by the modular algorithm
+    integer_class big(1);
+    big <<= 100;
+    RCP<const UIntPoly> f = UIntPoly::from_dict(x, {{0, big + 1}, {1, 3_z}});
+    RCP<const UIntPoly> g = UIntPoly::from_dict(x, {{0, big}, {2, 1_z}});
+    RCP<const UIntPoly> h = UIntPoly::from_dict(x, {{0, -7_z}, {3, 2_z}});
+    RCP<const UIntPoly> fgh = UIntPoly::from_container(
+        x, pow_upoly(*f, 3)->get_poly() * g->get_poly() * h->get_poly());
+    RCP<const UIntPoly> fg = UIntPoly::from_container(
+        x, pow_upoly(*f, 2)->get_poly() * g->get_poly() * UIntDict(6_z));
+    RCP<const UIntPoly> r = gcd_upoly(*fgh, *fg);
+    REQUIRE(eq(*r, *UIntPoly::from_container(
+                       x, pow_upoly(*f, 2)->get_poly() * g->get_poly())));
+    REQUIRE(eq(*gcd_upoly(*fg, *h), *UIntPoly::from_dict(x, {{0, 1_z}})));
+}
+
+// The product of `a` and `b` term by term
+UIntDict naive_mul(const UIntDict &a, const UIntDict &b)
+{
+    map_uint_mpz d;
+    for (const auto &x : a.dict_)
+        for (const auto &y : b.dict_)
+            d[x.first + y.first] += x.second * y.second;
+    UIntDict r;
+    for (const auto &t : d)
+        if (t.second != 0)
+            r.dict_.insert(t);
+    return r;
+}
+
+// A dense polynomial of degree `deg` with coefficients of about `bits` bits
+// and both signs
+UIntDict dense_upoly(unsigned deg, unsigned bits, unsigned seed)
+{
+    UIntDict r;
+    integer_class c(seed);
+    for (unsigned i = 0; i <= deg; i++) {
+        c = (c * 1103515245 + 12345) % 2147483648u;
+        integer_class t = c;
+        if (bits < 31)
+            t >>= 31 - bits;
+        else
+            t <<= bits - 31;
+        t += i;
+        if (c % 3 == 0)
+            t = -t;
+        if (t != 0)
+            r.dict_[i] = t;
+    }
+    return r;
+}
+
+TEST_CASE("UIntDict mul", "[UIntPoly]")
+{
+    // Products in the ranges of the schoolbook, Kronecker, Karatsuba and
+    // number theoretic transform multiplications
+    for (unsigned deg : {3u, 40u, 150u, 700u}) {
+        for (unsigned bits : {8u, 100u, 700u}) {
+            UIntDict a = dense_upoly(deg, bits, 1);
+            UIntDict b = dense_upoly(deg + 5, bits, 2);
+            UIntDict c = dense_upoly(deg / 4, bits, 3);
+            REQUIRE(UIntDict::mul(a, b) == naive_mul(a, b));
+            REQUIRE(UIntDict::mul(a, a) == naive_mul(a, a));
+            REQUIRE(UIntDict::mul(c, b) == naive_mul(c, b));
+        }
+    }
+
+    // Sparse and zero factors, and cancelling products
+    UIntDict s(map_uint_mpz{{0, 1_z}, {1000, 2_z}, {5000, -3_z}});
+    UIntDict d = dense_upoly(600, 8, 4);
+    REQUIRE(UIntDict::mul(s, d) == naive_mul(s, d));
+    REQUIRE(UIntDict::mul(d, UIntDict()).empty());
+    UIntDict p = dense_upoly(600, 8, 5);
+    UIntDict q = dense_upoly(600, 8, 5);
+    for (auto &t : q.dict_)
+        if (t.first % 2 == 1)
+            t.second = -t.second;
+    // p(x)*p(-x) is even
+    UIntDict r = UIntDict::mul(p, q);
+    REQUIRE(r == naive_mul(p, q));
+    bool even = true;
+    for (const auto &t : r.dict_)
+        even = even and t.first % 2 == 0;
+    REQUIRE(even);
+}
+
 #ifdef HAVE_SYMENGINE_PIRANHA
 TEST_CASE("UIntPoly from_poly piranha", "[UIntPoly]")
 {
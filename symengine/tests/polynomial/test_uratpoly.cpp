@@ -263,6 +263,25 @@ TEST_CASE("URatPoly divides", "[URatPoly]")
     REQUIRE(!divides_upoly(*a, *b, outArg(res)));
 }
 
+TEST_CASE("URatPoly gcd", "[URatPoly]")
+{
+    RCP<const Symbol> x = symbol("x");
+    RCP<const URatPoly> a = URatPoly::from_dict(x, {{2, 2_q}});
+    RCP<const URatPoly> b = URatPoly::from_dict(x, {{1, 3_q}});
+    RCP<const URatPoly> c = URatPoly::from_dict(
+        x, {{0, rc(3_z, 2_z)}, {1, 2_q}, {2, rc(1_z, 2_z)}});
+    RCP<const URatPoly> d
+        = URatPoly::from_dict(x, {{1, rc(4_z, 3_z)}, {2, rc(4_z, 3_z)}});
+    RCP<const URatPoly> z = URatPoly::from_dict(x, {{0, 0_q}});
+
+    REQUIRE(gcd_upoly(*a, *b)->__str__() == "x");
+    REQUIRE(gcd_upoly(*c, *d)->__str__() == "x + 1");
+    REQUIRE(gcd_upoly(*a, *d)->__str__() == "x");
+    REQUIRE(gcd_upoly(*b, *c)->__str__() == "1");
+    REQUIRE(gcd_upoly(*d, *z)->__str__() == "x**2 + x");
+    REQUIRE(gcd_upoly(*z, *z)->__str__() == "0");
+}
+
 TEST_CASE("URatPoly from_poly uint", "[URatPoly]")
 {
     RCP<const Symbol> x = symbol("x");
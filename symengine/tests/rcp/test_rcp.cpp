@@ -1,12 +1,24 @@
 #include "catch.hpp"
 
 #include <symengine/symengine_rcp.h>
+#include <symengine/pool_allocator.h>
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+#include <atomic>
+#include <thread>
+#endif
 
 using SymEngine::EnableRCPFromThis;
 using SymEngine::make_rcp;
 using SymEngine::null;
+using SymEngine::pool_allocate;
+using SymEngine::pool_allocator_stats;
+using SymEngine::pool_deallocate;
+using SymEngine::PoolArena;
+using SymEngine::PoolSizeClassStats;
 using SymEngine::Ptr;
 using SymEngine::RCP;
+using SymEngine::rcp_merge_queued;
 
 // This is the canonical use of EnableRCPFromThis:
 
@@ -110,3 +122,135 @@ TEST_CASE("Test rcp_from_this const 2", "[rcp]")
     f2_hybrid(*m2);
     REQUIRE(m2->use_count() == 1);
 }
+
+TEST_CASE("Test pool allocator", "[rcp]")
+{
+    std::vector<PoolSizeClassStats> stats = pool_allocator_stats();
+    REQUIRE(stats.size() == SymEngine::pool_size_classes);
+    REQUIRE(stats[0].block_size == SymEngine::pool_granularity);
+    REQUIRE(stats.back().block_size == SymEngine::pool_max_size);
+    // 40 bytes are served from the 48 bytes size class
+    size_t live = stats[2].live;
+
+    void *p1 = pool_allocate(40);
+    void *p2 = pool_allocate(40);
+    REQUIRE(p1 != p2);
+    REQUIRE(pool_allocator_stats()[2].live == live + 2);
+    pool_deallocate(p1, 40);
+    REQUIRE(pool_allocator_stats()[2].live == live + 1);
+    REQUIRE(pool_allocator_stats()[2].free > 0);
+    // The released block is reused first
+    void *p3 = pool_allocate(40);
+    REQUIRE(p3 == p1);
+    pool_deallocate(p3, 40);
+    pool_deallocate(p2, 40);
+    REQUIRE(pool_allocator_stats()[2].live == live);
+
+    // Large requests bypass the pool
+    void *p4 = pool_allocate(1000);
+    pool_deallocate(p4, 1000);
+
+    {
+        PoolArena arena;
+        void *a1 = pool_allocate(40);
+        void *a2 = pool_allocate(100);
+        REQUIRE(arena.live() == 2);
+        REQUIRE(arena.bytes_allocated() == 48 + 112);
+        REQUIRE(pool_allocator_stats()[2].live == live);
+        {
+            PoolArena inner;
+            void *a3 = pool_allocate(40);
+            REQUIRE(inner.live() == 1);
+            // Objects of the outer arena can be released in the inner one
+            pool_deallocate(a1, 40);
+            REQUIRE(arena.live() == 1);
+            pool_deallocate(a3, 40);
+        }
+        pool_deallocate(a2, 100);
+        REQUIRE(arena.live() == 0);
+    }
+
+
+#if defined(WITH_SYMENGINE_POOL_ALLOCATOR)
+    // Objects created by make_rcp() come from the pool
+    unsigned c = (sizeof(Mesh2) - 1) / SymEngine::pool_granularity;
+    live = pool_allocator_stats()[c].live;
+    RCP<const Mesh2> m = make_rcp<const Mesh2>();
+    REQUIRE(pool_allocator_stats()[c].live == live + 1);
+    m = null;
+    REQUIRE(pool_allocator_stats()[c].live == live);
+#endif
+}
+
+#if defined(WITH_SYMENGINE_THREAD_SAFE)
+
+std::atomic<int> counted_live(0);
+
+class Counted : public EnableRCPFromThis<Counted>
+{
+public:
+    Counted()
+    {
+        counted_live++;
+    }
+    ~Counted()
+    {
+        counted_live--;
+    }
+};
+
+TEST_CASE("Test RCP across threads", "[rcp]")
+{
+    const unsigned n = 4;
+    std::vector<std::thread> threads;
+
+    // Copies of an object owned by the main thread
+    RCP<const Counted> shared = make_rcp<const Counted>();
+    for (unsigned i = 0; i < n; i++) {
+        threads.emplace_back([&shared]() {
+            std::vector<RCP<const Counted>> v;
+            for (unsigned j = 0; j < 1000; j++)
+                v.push_back(shared);
+            v.clear();
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    threads.clear();
+    REQUIRE(shared->use_count() == 1);
+
+    // Objects created by threads that exit, released by the main thread
+    std::vector<RCP<const Counted>> created(n);
+    for (unsigned i = 0; i < n; i++) {
+        threads.emplace_back([&created, i, &shared]() {
+            created[i] = make_rcp<const Counted>();
+            RCP<const Counted> copy = shared;
+        });
+    }
+    for (auto &t : threads)
+        t.join();
+    threads.clear();
+    REQUIRE(counted_live == 1 + n);
+    for (unsigned i = 0; i < n; i++)
+        REQUIRE(created[i]->use_count() == 1);
+    created.clear();
+    REQUIRE(counted_live == 1);
+
+    // Objects handed over to other threads and released there
+    std::vector<RCP<const Counted>> handed(n);
+    for (unsigned i = 0; i < n; i++)
+        handed[i] = make_rcp<const Counted>();
+    for (unsigned i = 0; i < n; i++) {
+        threads.emplace_back([&handed, i]() { handed[i] = null; });
+    }
+    for (auto &t : threads)
+        t.join();
+    threads.clear();
+    rcp_merge_queued();
+    REQUIRE(counted_live == 1);
+
+    shared = null;
+    REQUIRE(counted_live == 0);
+}
+
+#endif
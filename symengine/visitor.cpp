@@ -16,40 +16,115 @@ namespace SymEngine
 #include "symengine/type_codes.inc"
 #undef SYMENGINE_ENUM
 
-void preorder_traversal(const Basic &b, Visitor &v)
+namespace
 {
-    b.accept(v);
-    for (const auto &p : b.get_args())
-        preorder_traversal(*p, v);
-}
 
-void postorder_traversal(const Basic &b, Visitor &v)
+// Stack of the nodes that are still to be visited by a preorder traversal
+class PreorderStack
 {
-    for (const auto &p : b.get_args())
-        postorder_traversal(*p, v);
-    b.accept(v);
+private:
+    vec_basic stack_;
+    bool once_;
+    uset_basic visited_;
+
+public:
+    PreorderStack(const Basic &b, bool once) : once_(once)
+    {
+        stack_.push_back(b.rcp_from_this());
+    }
+
+    //! \return the next node to visit, or null at the end
+    RCP<const Basic> pop()
+    {
+        while (not stack_.empty()) {
+            RCP<const Basic> b = std::move(stack_.back());
+            stack_.pop_back();
+            if (not once_ or visited_.insert(b).second)
+                return b;
+        }
+        return null;
+    }
+
+    //! Pushes the nodes of `args`, so that they are visited in order
+    void push(vec_basic &args)
+    {
+        stack_.insert(stack_.end(), std::make_move_iterator(args.rbegin()),
+                      std::make_move_iterator(args.rend()));
+        args.clear();
+    }
+
+    //! Pushes the arguments of `b`, so that they are visited in order
+    void push_args(const Basic &b)
+    {
+        size_t n = stack_.size();
+        b.for_each_arg(
+            [this](const RCP<const Basic> &p) { stack_.push_back(p); });
+        std::reverse(stack_.begin() + n, stack_.end());
+    }
+};
+
+// Postorder traversal, `stop()` is checked after every visit
+template <typename Stop>
+void postorder(const Basic &b, Visitor &v, bool once, Stop stop)
+{
+    // A node is first pushed with `false`. When it is popped, it is pushed
+    // again with `true` above its arguments, and visited when it is popped
+    // the second time.
+    std::vector<std::pair<RCP<const Basic>, bool>> stack;
+    uset_basic visited;
+    stack.push_back(std::make_pair(b.rcp_from_this(), false));
+    while (not stack.empty()) {
+        std::pair<RCP<const Basic>, bool> p = std::move(stack.back());
+        stack.pop_back();
+        if (p.second) {
+            p.first->accept(v);
+            if (stop())
+                return;
+            continue;
+        }
+        if (once and not visited.insert(p.first).second)
+            continue;
+        size_t n = stack.size() + 1;
+        stack.push_back(std::make_pair(p.first, true));
+        p.first->for_each_arg([&stack](const RCP<const Basic> &a) {
+            stack.push_back(std::make_pair(a, false));
+        });
+        std::reverse(stack.begin() + n, stack.end());
+    }
 }
 
-void preorder_traversal_stop(const Basic &b, StopVisitor &v)
+} // namespace
+
+void preorder_traversal(const Basic &b, Visitor &v, bool once)
 {
-    b.accept(v);
-    if (v.stop_)
-        return;
-    for (const auto &p : b.get_args()) {
-        preorder_traversal_stop(*p, v);
-        if (v.stop_)
-            return;
+    PreorderStack stack(b, once);
+    RCP<const Basic> p;
+    while (not(p = stack.pop()).is_null()) {
+        p->accept(v);
+        stack.push_args(*p);
     }
 }
 
-void postorder_traversal_stop(const Basic &b, StopVisitor &v)
+void postorder_traversal(const Basic &b, Visitor &v, bool once)
+{
+    postorder(b, v, once, [] { return false; });
+}
+
+void preorder_traversal_stop(const Basic &b, StopVisitor &v, bool once)
 {
-    for (const auto &p : b.get_args()) {
-        postorder_traversal_stop(*p, v);
+    PreorderStack stack(b, once);
+    RCP<const Basic> p;
+    while (not(p = stack.pop()).is_null()) {
+        p->accept(v);
         if (v.stop_)
             return;
+        stack.push_args(*p);
     }
-    b.accept(v);
+}
+
+void postorder_traversal_stop(const Basic &b, StopVisitor &v, bool once)
+{
+    postorder(b, v, once, [&v] { return v.stop_; });
 }
 
 bool has_basic(const Basic &b, const Basic &x)
@@ -79,15 +154,16 @@ RCP<const Basic> coeff(const Basic &b, const Basic &x, const Basic &n)
     return v.apply(b);
 }
 
-class FreeSymbolsVisitor : public BaseVisitor<FreeSymbolsVisitor>
+class FreeSymbolsVisitor
+    : public BaseVisitor<FreeSymbolsVisitor, LocalStopVisitor>
 {
 public:
     set_basic s;
-    uset_basic v;
 
     void bvisit(const Symbol &x)
     {
         s.insert(x.rcp_from_this());
+        local_stop_ = false;
     }
 
     void bvisit(const Subs &x)
@@ -98,34 +174,48 @@ public:
         }
         s.insert(set_.begin(), set_.end());
         for (const auto &p : x.get_point()) {
-            auto iter = v.insert(p->rcp_from_this());
-            if (iter.second) {
-                p->accept(*this);
-            }
+            local_args_.push_back(p);
         }
+        local_stop_ = true;
     }
 
-    void bvisit(const Basic &x)
+    // The terms of an Add and the factors of a Mul are not built, only their
+    // stored parts are visited. The numeric coefficients have no symbols.
+    void bvisit(const Add &x)
     {
-        for (const auto &p : x.get_args()) {
-            auto iter = v.insert(p->rcp_from_this());
-            if (iter.second) {
-                p->accept(*this);
-            }
+        for (const auto &p : x.get_dict()) {
+            local_args_.push_back(p.first);
         }
+        local_stop_ = true;
+    }
+
+    void bvisit(const Mul &x)
+    {
+        for (const auto &p : x.get_dict()) {
+            local_args_.push_back(p.first);
+            local_args_.push_back(p.second);
+        }
+        local_stop_ = true;
+    }
+
+    void bvisit(const Basic &x)
+    {
+        local_stop_ = false;
     }
 
     set_basic apply(const Basic &b)
     {
-        b.accept(*this);
+        stop_ = false;
+        preorder_traversal_local_stop(b, *this, true);
         return s;
     }
 
     set_basic apply(const MatrixBase &m)
     {
+        stop_ = false;
         for (unsigned i = 0; i < m.nrows(); i++) {
             for (unsigned j = 0; j < m.ncols(); j++) {
-                m.get(i, j)->accept(*this);
+                preorder_traversal_local_stop(*m.get(i, j), *this, true);
             }
         }
         return s;
@@ -166,7 +256,11 @@ HasBasicVisitor::HasBasicVisitor(Ptr<const Basic> looking_for)
 
 RCP<const Basic> TransformVisitor::apply(const RCP<const Basic> &x)
 {
+    auto it = cache_.find(x);
+    if (it != cache_.end())
+        return it->second;
     x->accept(*this);
+    cache_.insert(std::make_pair(x, result_));
     return result_;
 }
 
@@ -244,27 +338,64 @@ void TransformVisitor::bvisit(const Piecewise &x)
     result_ = piecewise(new_pairs);
 }
 
-void preorder_traversal_local_stop(const Basic &b, LocalStopVisitor &v)
+void preorder_traversal_local_stop(const Basic &b, LocalStopVisitor &v,
+                                   bool once)
 {
-    b.accept(v);
-    if (v.stop_ or v.local_stop_)
-        return;
-    for (const auto &p : b.get_args()) {
-        preorder_traversal_local_stop(*p, v);
+    PreorderStack stack(b, once);
+    RCP<const Basic> p;
+    v.local_args_.clear();
+    while (not(p = stack.pop()).is_null()) {
+        p->accept(v);
         if (v.stop_)
             return;
+        if (v.local_stop_) {
+            stack.push(v.local_args_);
+        } else {
+            v.local_args_.clear();
+            stack.push_args(*p);
+        }
     }
 }
 
+// The counts are computed with an explicit stack. The node on top of the
+// stack is first visited with `pending_` set, which only collects the
+// arguments whose count is not known yet. Once there are none, it is
+// visited again to add up its count.
 void CountOpsVisitor::apply(const Basic &b)
 {
-    unsigned count_now = count;
-    auto it = v.find(b.rcp_from_this());
-    if (it == v.end()) {
-        b.accept(*this);
-        insert(v, b.rcp_from_this(), count - count_now);
-    } else {
+    unsigned total = count;
+    vec_basic stack = {b.rcp_from_this()};
+    vec_basic pending;
+    while (not stack.empty()) {
+        RCP<const Basic> x = stack.back();
+        if (v.find(x) != v.end()) {
+            stack.pop_back();
+            continue;
+        }
+        pending_ = &pending;
+        x->accept(*this);
+        pending_ = nullptr;
+        if (not pending.empty()) {
+            stack.insert(stack.end(), pending.begin(), pending.end());
+            pending.clear();
+            continue;
+        }
+        count = 0;
+        x->accept(*this);
+        insert(v, x, count);
+        stack.pop_back();
+    }
+    count = total + v.find(b.rcp_from_this())->second;
+}
+
+void CountOpsVisitor::count_arg(const RCP<const Basic> &b)
+{
+    auto it = v.find(b);
+    if (it != v.end()) {
         count += it->second;
+    } else {
+        SYMENGINE_ASSERT(pending_ != nullptr)
+        pending_->push_back(b);
     }
 }
 
@@ -272,15 +403,15 @@ void CountOpsVisitor::bvisit(const Mul &x)
 {
     if (neq(*(x.get_coef()), *one)) {
         count++;
-        apply(*x.get_coef());
+        count_arg(x.get_coef());
     }
 
     for (const auto &p : x.get_dict()) {
         if (neq(*p.second, *one)) {
             count++;
-            apply(*p.second);
+            count_arg(p.second);
         }
-        apply(*p.first);
+        count_arg(p.first);
         count++;
     }
     count--;
@@ -290,15 +421,15 @@ void CountOpsVisitor::bvisit(const Add &x)
 {
     if (neq(*(x.get_coef()), *zero)) {
         count++;
-        apply(*x.get_coef());
+        count_arg(x.get_coef());
     }
 
     for (const auto &p : x.get_dict()) {
         if (neq(*p.second, *one)) {
             count++;
-            apply(*p.second);
+            count_arg(p.second);
         }
-        apply(*p.first);
+        count_arg(p.first);
         count++;
     }
     count--;
@@ -307,8 +438,8 @@ void CountOpsVisitor::bvisit(const Add &x)
 void CountOpsVisitor::bvisit(const Pow &x)
 {
     count++;
-    apply(*x.get_exp());
-    apply(*x.get_base());
+    count_arg(x.get_exp());
+    count_arg(x.get_base());
 }
 
 void CountOpsVisitor::bvisit(const Number &x) {}
@@ -331,9 +462,7 @@ void CountOpsVisitor::bvisit(const Constant &x) {}
 void CountOpsVisitor::bvisit(const Basic &x)
 {
     count++;
-    for (const auto &p : x.get_args()) {
-        apply(*p);
-    }
+    x.for_each_arg([this](const RCP<const Basic> &p) { count_arg(p); });
 }
 
 unsigned count_ops(const vec_basic &a)
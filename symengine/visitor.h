@@ -40,8 +40,17 @@ public:
 #undef SYMENGINE_ENUM
 };
 
-void preorder_traversal(const Basic &b, Visitor &v);
-void postorder_traversal(const Basic &b, Visitor &v);
+/*! The traversals call `v` on every node of `b`, using an explicit stack,
+ *  so that the depth of `b` is not limited by the call stack. The arguments
+ *  of a node are traversed in the order of `get_args()`.
+ *
+ *  If `once` is true, equal subexpressions are visited (and descended into)
+ *  only once. The cost is then linear in the number of distinct nodes, also
+ *  for expressions with shared subtrees, whose trees can be exponentially
+ *  larger.
+ * */
+void preorder_traversal(const Basic &b, Visitor &v, bool once = false);
+void postorder_traversal(const Basic &b, Visitor &v, bool once = false);
 
 template <class Derived, class Base = Visitor>
 class BaseVisitor : public Base
@@ -84,11 +93,17 @@ class LocalStopVisitor : public StopVisitor
 {
 public:
     bool local_stop_;
+    //! If a visit sets `local_stop_`, the nodes it appends here are traversed
+    //! instead of the arguments of the visited node.
+    vec_basic local_args_;
 };
 
-void preorder_traversal_stop(const Basic &b, StopVisitor &v);
-void postorder_traversal_stop(const Basic &b, StopVisitor &v);
-void preorder_traversal_local_stop(const Basic &b, LocalStopVisitor &v);
+void preorder_traversal_stop(const Basic &b, StopVisitor &v,
+                             bool once = false);
+void postorder_traversal_stop(const Basic &b, StopVisitor &v,
+                              bool once = false);
+void preorder_traversal_local_stop(const Basic &b, LocalStopVisitor &v,
+                                   bool once = false);
 
 class HasBasicVisitor : public BaseVisitor<HasBasicVisitor, StopVisitor>
 {
@@ -102,7 +117,7 @@ public:
     {
         has_ = false;
         stop_ = false;
-        preorder_traversal_stop(b, *this);
+        preorder_traversal_stop(b, *this, true);
         return has_;
     }
     void bvisit(const Basic &arg)
@@ -114,7 +129,8 @@ public:
     }
 };
 
-class HasSymbolVisitor : public BaseVisitor<HasSymbolVisitor, StopVisitor>
+class HasSymbolVisitor
+    : public BaseVisitor<HasSymbolVisitor, LocalStopVisitor>
 {
 protected:
     Ptr<const Basic> x_;
@@ -137,15 +153,38 @@ public:
             has_ = true;
             stop_ = true;
         }
+        local_stop_ = false;
     }
 
-    void bvisit(const Basic &x) {}
+    // The terms of an Add and the factors of a Mul are not built, only their
+    // stored parts are searched.
+    void bvisit(const Add &x)
+    {
+        for (const auto &p : x.get_dict()) {
+            local_args_.push_back(p.first);
+        }
+        local_stop_ = true;
+    }
+
+    void bvisit(const Mul &x)
+    {
+        for (const auto &p : x.get_dict()) {
+            local_args_.push_back(p.first);
+            local_args_.push_back(p.second);
+        }
+        local_stop_ = true;
+    }
+
+    void bvisit(const Basic &x)
+    {
+        local_stop_ = false;
+    }
 
     bool apply(const Basic &b)
     {
         has_ = false;
         stop_ = false;
-        preorder_traversal_stop(b, *this);
+        preorder_traversal_local_stop(b, *this, true);
         return has_;
     }
 };
@@ -183,7 +222,7 @@ public:
     {
         for (auto &p : x.get_dict()) {
             if (eq(*p.first, *x_) and eq(*p.second, *n_)) {
-                map_basic_basic dict = x.get_dict();
+                fmap_basic_basic dict = x.get_dict();
                 dict.erase(p.first);
                 coeff_ = Mul::from_dict(x.get_coef(), std::move(dict));
                 return;
@@ -262,6 +301,9 @@ class TransformVisitor : public BaseVisitor<TransformVisitor>
 {
 protected:
     RCP<const Basic> result_;
+    //! Results of `apply()`, so that equal subexpressions are only
+    //! transformed once
+    umap_basic_basic cache_;
 
 public:
     TransformVisitor() {}
@@ -306,30 +348,19 @@ class AtomsVisitor : public BaseVisitor<AtomsVisitor<Args...>>
 {
 public:
     set_basic s;
-    uset_basic visited;
 
     template <typename T,
               typename = enable_if_t<is_base_of_multiple<T, Args...>::value>>
     void bvisit(const T &x)
     {
         s.insert(x.rcp_from_this());
-        visited.insert(x.rcp_from_this());
-        bvisit((const Basic &)x);
     }
 
-    void bvisit(const Basic &x)
-    {
-        for (const auto &p : x.get_args()) {
-            auto iter = visited.insert(p->rcp_from_this());
-            if (iter.second) {
-                p->accept(*this);
-            }
-        }
-    }
+    void bvisit(const Basic &x) {}
 
     set_basic apply(const Basic &b)
     {
-        b.accept(*this);
+        preorder_traversal(b, *this, true);
         return s;
     }
 };
@@ -346,6 +377,10 @@ class CountOpsVisitor : public BaseVisitor<CountOpsVisitor>
 protected:
     std::unordered_map<RCP<const Basic>, unsigned, RCPBasicHash, RCPBasicKeyEq>
         v;
+    //! Arguments whose count is not known yet, see `apply()`
+    vec_basic *pending_ = nullptr;
+
+    void count_arg(const RCP<const Basic> &b);
 
 public:
     unsigned count = 0;